@@ -0,0 +1,330 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include "seal-io.h"
+#include "diagnostics.h"
+#include "dumpformat.h"
+#include "workpool.h"
+#include "batch.h"
+
+extern char *out_filename;     // -o
+extern int dump_format;        // -f
+extern int jobs;               // -j
+
+//
+// Sets out to where the output of file goes, "" for standard output.
+// False if -o names a single file and there are n > 1 inputs.
+//
+static bool output_name(const char *file, int n, std::string &out)
+{
+    out.clear();
+    if (out_filename == NULL)
+        return true;
+
+    std::string spec = out_filename;
+    std::string name = file;
+    if (name.size() >= 5 && name.compare(name.size() - 5, 5, ".seal") == 0)
+        name.erase(name.size() - 5);
+
+    struct stat st;
+    bool dir = spec[spec.size() - 1] == '/' ||
+               (stat(out_filename, &st) == 0 && S_ISDIR(st.st_mode));
+    if (dir) {
+        static const char *suffixes[] = { ".out", ".jsonl", ".bin" };
+        size_t slash = name.rfind('/');
+        if (slash != std::string::npos)
+            name.erase(0, slash + 1);
+        if (spec[spec.size() - 1] != '/')
+            spec += '/';
+        out = spec + name + suffixes[dump_format];
+    } else if (spec[0] == '.' && spec.find('/') == std::string::npos) {
+        out = name + spec;
+    } else if (n == 1) {
+        out = spec;
+    } else
+        return false;
+    return true;
+}
+
+//
+// Points standard output at the file name; returns a descriptor of what
+// it was, for restore_stdout(), or -1 if name cannot be written.
+//
+static int redirect_stdout(const std::string &name)
+{
+    cout.flush();
+    fflush(stdout);
+    int fd = open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0)
+        return -1;
+    int saved = dup(1);
+    dup2(fd, 1);
+    close(fd);
+    return saved;
+}
+
+static void restore_stdout(int saved)
+{
+    cout.flush();
+    fflush(stdout);
+    dup2(saved, 1);
+    close(saved);
+}
+
+//
+// Compiles file with its output going to out ("" for standard output).
+//
+static int compile_unit(const char *file, const std::string &out,
+                        int (*compile)(const char *file))
+{
+    int saved = -1;
+    if (!out.empty() && (saved = redirect_stdout(out)) < 0) {
+        cerr << "Could not open output file " << out << endl;
+        return 1;
+    }
+    int status;
+    try {
+        status = compile(file);
+    } catch (CompileHalted &h) {
+        status = h.status;
+    }
+    if (saved >= 0)
+        restore_stdout(saved);
+    return status;
+}
+
+//
+// A file compiled by a child process.  What it writes to standard error,
+// and to standard output if -o does not send that elsewhere, is kept in
+// temporary files until it is the file's turn to be shown.
+//
+struct Unit {
+    FILE *out, *err;
+    int status;
+};
+
+static void write_all(int fd, const char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t w = write(fd, buf, len);
+        if (w <= 0)
+            return;
+        buf += w;
+        len -= w;
+    }
+}
+
+// copies the temporary file f to descriptor fd and closes it
+static void copy_out(FILE *f, int fd)
+{
+    if (f == NULL)
+        return;
+    char buf[1 << 16];
+    ssize_t r;
+    lseek(fileno(f), 0, SEEK_SET);
+    while ((r = read(fileno(f), buf, sizeof buf)) > 0)
+        write_all(fd, buf, r);
+    fclose(f);
+}
+
+//
+// Starts a process compiling file.  Returns its pid, or -1 with u.status
+// set if there is none.
+//
+static pid_t start_child(const char *file, const std::string &out,
+                         int (*compile)(const char *file), Unit &u)
+{
+    u.err = tmpfile();
+    u.out = out.empty() ? tmpfile() : NULL;
+    if (u.err == NULL || (out.empty() && u.out == NULL)) {
+        u.status = 1;
+        return -1;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        dup2(fileno(u.err), 2);
+        if (u.out != NULL)
+            dup2(fileno(u.out), 1);
+        jobs = 1;
+        int status = compile_unit(file, out, compile);
+        cout.flush();
+        cerr.flush();
+        exit(status & 0xff);
+    }
+    if (pid < 0) {
+        fprintf(u.err, "Could not start a process for %s\n", file);
+        u.status = 1;
+    }
+    return pid;
+}
+
+static int exit_status(int st)
+{
+    if (WIFEXITED(st))
+        return WEXITSTATUS(st);
+    return 128 + WTERMSIG(st);
+}
+
+//
+// The order the files are started in: largest first, so that the small
+// ones are left to the end, where they even out the load.
+//
+static std::vector<int> schedule(int n, char **files)
+{
+    std::vector<std::pair<off_t, int> > by_size(n);
+    for (int i = 0; i < n; i++) {
+        struct stat st;
+        by_size[i].first = stat(files[i], &st) == 0 ? -st.st_size : 0;
+        by_size[i].second = i;
+    }
+    std::stable_sort(by_size.begin(), by_size.end());
+
+    std::vector<int> order(n);
+    for (int k = 0; k < n; k++)
+        order[k] = by_size[k].second;
+    return order;
+}
+
+//
+// Runs the files in child processes, procs of them at a time, and shows
+// what each wrote in the order of the files, each as soon as it and all
+// before it are done.  The children are forked and waited for by the
+// calling thread alone, never from a thread of a pool, and the next file
+// starts as soon as any of them finishes.
+//
+static void compile_parallel(int n, char **files,
+                             const std::vector<std::string> &outs,
+                             int (*compile)(const char *file),
+                             int procs, std::vector<int> &status)
+{
+    std::vector<Unit> units(n);
+    std::vector<bool> done(n, false);
+    std::vector<int> order = schedule(n, files);
+    std::map<pid_t, int> running;
+    int started = 0, next = 0;
+
+    cout.flush();
+    fflush(stdout);
+    fflush(stderr);
+    while (next < n) {
+        for (; started < n && (int) running.size() < procs; started++) {
+            int i = order[started];
+            pid_t pid = start_child(files[i], outs[i], compile, units[i]);
+            if (pid > 0)
+                running[pid] = i;
+            else
+                done[i] = true;
+        }
+        if (!running.empty()) {
+            int st;
+            pid_t pid = waitpid(-1, &st, 0);
+            if (pid < 0 && errno == EINTR)
+                continue;
+            if (pid < 0) {
+                // lost track of them: count them as failed
+                for (std::map<pid_t, int>::iterator r = running.begin();
+                     r != running.end(); ++r) {
+                    units[r->second].status = 1;
+                    done[r->second] = true;
+                }
+                running.clear();
+            } else if (running.count(pid)) {
+                int i = running[pid];
+                running.erase(pid);
+                units[i].status = exit_status(st);
+                done[i] = true;
+            }
+        }
+        for (; next < n && done[next]; next++) {
+            copy_out(units[next].err, 2);
+            copy_out(units[next].out, 1);
+            status[next] = units[next].status;
+        }
+    }
+}
+
+static double cpu_seconds()
+{
+    struct rusage self, children;
+    getrusage(RUSAGE_SELF, &self);
+    getrusage(RUSAGE_CHILDREN, &children);
+    struct timeval *t[] = { &self.ru_utime, &self.ru_stime,
+                            &children.ru_utime, &children.ru_stime };
+    double sum = 0;
+    for (int i = 0; i < 4; i++)
+        sum += t[i]->tv_sec + t[i]->tv_usec / 1e6;
+    return sum;
+}
+
+int compile_batch(int n, char **files, int (*compile)(const char *file))
+{
+    std::vector<std::string> outs(n);
+    for (int i = 0; i < n; i++)
+        if (!output_name(files[i], n, outs[i])) {
+            cerr << "With more than one input file, -o must be a directory or a .suffix\n";
+            return 1;
+        }
+    // two files writing one output would have one overwrite the other
+    std::map<std::string, int> writer;
+    for (int i = 0; i < n; i++) {
+        if (outs[i].empty())
+            continue;
+        std::pair<std::map<std::string, int>::iterator, bool> ins =
+            writer.insert(std::make_pair(outs[i], i));
+        if (!ins.second) {
+            cerr << files[ins.first->second] << " and " << files[i]
+                 << " would both be written to " << outs[i] << "\n";
+            return 1;
+        }
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    double cpu_start = cpu_seconds();
+    int procs = n > 1 ? parallel_threads(n, jobs) : 1;
+    bool recover = diagnostics.recover;
+    diagnostics.recover = true;
+    std::vector<int> status(n);
+    if (procs > 1)
+        compile_parallel(n, files, outs, compile, procs, status);
+    else
+        for (int i = 0; i < n; i++)
+            status[i] = compile_unit(files[i], outs[i], compile);
+    diagnostics.recover = recover;
+
+    if (n == 1)
+        return status[0];
+    int failed = 0;
+    for (int i = 0; i < n; i++) {
+        cerr << files[i] << ": ";
+        if (status[i] == 0)
+            cerr << "ok\n";
+        else {
+            cerr << "failed, status " << (status[i] & 0xff) << "\n";
+            failed++;
+        }
+    }
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    char times[128];
+    snprintf(times, sizeof times, "%.2fs wall, %.2fs cpu, %d worker%s",
+             wall, cpu_seconds() - cpu_start, procs, procs == 1 ? "" : "s");
+    cerr << n << " files, " << n - failed << " ok, " << failed << " failed; "
+         << times << "\n";
+    return failed > 0 ? 1 : 0;
+}
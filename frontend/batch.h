@@ -0,0 +1,49 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _BATCH_H_
+#define _BATCH_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Batch compilation
+//
+//  compile_batch(n, files, compile) compiles n files one after another in
+//  this process.  compile(file) compiles one: it writes the output to
+//  standard output and the errors to standard error, and returns the
+//  status a process compiling only that file would exit with; it may
+//  instead throw CompileHalted, as the diagnostics do while the batch
+//  runs.  The output of each file goes where -o says:
+//
+//      no -o           standard output, one file after another
+//      -o dir/         dir/<name>.out, where name is the file's name
+//                      without directory and .seal (.jsonl and .bin
+//                      with -f json and binary); dir must exist
+//      -o .suffix      next to the file, .seal replaced by .suffix
+//      -o file         that file, when there is only one input
+//
+//  Two inputs whose outputs would be the same file, such as a/x.seal and
+//  b/x.seal with -o dir/, are an error, and nothing is compiled.
+//
+//  With more than one file and -j other than 1, the files are compiled
+//  -j at a time (0: one per CPU), each by a process of its own forked
+//  for it, since the front end keeps its state in globals.  Only the
+//  calling thread forks; the largest files are started first, and the
+//  next whenever a process finishes.  What each file writes to standard
+//  output and standard error is held back and shown in the order of the
+//  files, so the output is the same as compiling them one after another.
+//
+//  With more than one file, a line for each with its status and a total,
+//  with the wall and CPU time taken, go to standard error after the last.
+//  Returns the exit status: that of the file for one file, else 0 if all
+//  of them gave 0 and 1 if not.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+int compile_batch(int n, char **files, int (*compile)(const char *file));
+
+#endif
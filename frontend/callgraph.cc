@@ -0,0 +1,163 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <string.h>
+#include <fstream>
+#include <algorithm>
+#include "callgraph.h"
+
+CallGraph call_graph;
+
+void CallGraph::build(const std::vector<std::vector<int> > &calls,
+                      const std::vector<bool> &dropped)
+{
+    std::vector<int> number(size(), -1);
+    std::vector<CallDecl> kept;
+    for (int f = 0; f < size(); f++)
+        if (!dropped[f]) {
+            number[f] = kept.size();
+            kept.push_back(functions[f]);
+        }
+
+    std::vector<int> seen(kept.size(), -1);
+    first.assign(1, 0);
+    callees.clear();
+    for (int f = 0; f < size(); f++) {
+        if (number[f] < 0)
+            continue;
+        for (int g : calls[f])
+            if (number[g] >= 0 && seen[number[g]] != number[f]) {
+                seen[number[g]] = number[f];
+                callees.push_back(number[g]);
+            }
+        first.push_back(callees.size());
+    }
+    functions.swap(kept);
+    find_components();
+}
+
+//
+// Tarjan's algorithm, with an explicit stack so that a long chain of
+// calls does not run out of C++ stack.  A component is numbered when its
+// root is finished, which is after every component it reaches.
+//
+void CallGraph::find_components()
+{
+    int n = size();
+    std::vector<int> index(n, -1), low(n), next(n);
+    std::vector<int> open;          // visited, component not yet known
+    std::vector<int> path;          // the functions being visited
+    int visited = 0;
+
+    component.assign(n, -1);
+    components = 0;
+    for (int root = 0; root < n; root++) {
+        if (index[root] >= 0)
+            continue;
+        path.push_back(root);
+        index[root] = low[root] = visited++;
+        next[root] = first[root];
+        open.push_back(root);
+
+        while (!path.empty()) {
+            int f = path.back();
+            if (next[f] < first[f + 1]) {
+                int g = callees[next[f]++];
+                if (index[g] < 0) {
+                    index[g] = low[g] = visited++;
+                    next[g] = first[g];
+                    open.push_back(g);
+                    path.push_back(g);
+                } else if (component[g] < 0)
+                    low[f] = std::min(low[f], index[g]);
+                continue;
+            }
+
+            path.pop_back();
+            if (!path.empty())
+                low[path.back()] = std::min(low[path.back()], low[f]);
+            if (low[f] == index[f]) {
+                int g;
+                do {
+                    g = open.back();
+                    open.pop_back();
+                    component[g] = components;
+                } while (g != f);
+                components++;
+            }
+        }
+    }
+}
+
+static void quoted(ostream &stream, Symbol name)
+{
+    stream << '"' << name << '"';
+}
+
+void CallGraph::dump_dot(ostream &stream) const
+{
+    std::vector<int> members(components, 0);
+    for (int f = 0; f < size(); f++)
+        members[component[f]]++;
+
+    stream << "digraph calls {\n";
+    for (int c = 0; c < components; c++) {
+        if (members[c] < 2)
+            continue;
+        stream << "  subgraph cluster_" << c << " {\n";
+        for (int f = 0; f < size(); f++)
+            if (component[f] == c) {
+                stream << "    ";
+                quoted(stream, functions[f]->getName());
+                stream << ";\n";
+            }
+        stream << "  }\n";
+    }
+    for (int f = 0; f < size(); f++) {
+        stream << "  ";
+        quoted(stream, functions[f]->getName());
+        stream << ";\n";
+        for (const int *g = calls_begin(f); g != calls_end(f); g++) {
+            stream << "  ";
+            quoted(stream, functions[f]->getName());
+            stream << " -> ";
+            quoted(stream, functions[*g]->getName());
+            stream << ";\n";
+        }
+    }
+    stream << "}\n";
+}
+
+void CallGraph::dump_json(ostream &stream) const
+{
+    stream << "{\"components\": " << components << ", \"functions\": [";
+    for (int f = 0; f < size(); f++) {
+        stream << (f > 0 ? ",\n  " : "\n  ") << "{\"name\": ";
+        quoted(stream, functions[f]->getName());
+        stream << ", \"line\": " << functions[f]->get_line_number()
+               << ", \"component\": " << component[f] << ", \"calls\": [";
+        for (const int *g = calls_begin(f); g != calls_end(f); g++) {
+            if (g != calls_begin(f))
+                stream << ", ";
+            quoted(stream, functions[*g]->getName());
+        }
+        stream << "]}";
+    }
+    stream << "\n]}\n";
+}
+
+bool CallGraph::write(const char *filename) const
+{
+    std::ofstream out(filename);
+    if (!out)
+        return false;
+    size_t n = strlen(filename);
+    if (n >= 5 && strcmp(filename + n - 5, ".json") == 0)
+        dump_json(out);
+    else
+        dump_dot(out);
+    return out.good();
+}
@@ -0,0 +1,64 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _CALLGRAPH_H_
+#define _CALLGRAPH_H_
+
+#include <vector>
+#include "seal-decl.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Call graph
+//
+//  Built by Program_class::semant() from the calls found while checking,
+//  for the passes after it.  Function i is the i-th function defined in
+//  the program (a second definition of a name is not one) that -D did not
+//  drop as unreachable; printf is not a function here.
+//
+//  functions       the declaration of each function
+//  first, callees  the functions called by f are callees[first[f]] up to
+//                  callees[first[f + 1]], each once, in the order of the
+//                  first call
+//  component       the strongly connected component of each function.
+//                  Components are numbered bottom-up: what a function
+//                  calls is in its own component or in one numbered lower.
+//  components      the number of components
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class CallGraph {
+public:
+    std::vector<CallDecl> functions;
+    std::vector<int> first;
+    std::vector<int> callees;
+    std::vector<int> component;
+    int components;
+
+    CallGraph() : components(0) { }
+
+    int size() const { return functions.size(); }
+    const int *calls_begin(int f) const { return callees.data() + first[f]; }
+    const int *calls_end(int f) const { return callees.data() + first[f + 1]; }
+    // set the calls of each function from calls[f], which may repeat,
+    // leaving out each f with dropped[f] and numbering the rest anew, and
+    // find the components
+    void build(const std::vector<std::vector<int> > &calls,
+               const std::vector<bool> &dropped);
+
+    void dump_dot(ostream &stream) const;
+    void dump_json(ostream &stream) const;
+    // by the extension of the file name: .json, otherwise DOT
+    bool write(const char *filename) const;
+
+private:
+    void find_components();
+};
+
+extern CallGraph call_graph;
+
+#endif
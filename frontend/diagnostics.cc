@@ -0,0 +1,179 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "diagnostics.h"
+
+DiagnosticEngine diagnostics;
+
+DiagArgs::~DiagArgs()
+{
+    engine->commit();
+}
+
+DiagArgs DiagnosticEngine::report(int line, const DiagKind &kind)
+{
+    check();
+    Diagnostic d;
+    d.line = line;
+    d.kind = &kind;
+    diags.push_back(d);
+    return DiagArgs(this, &diags.back());
+}
+
+//
+// The last diagnostic is complete: drop it if it was seen before, or if
+// there are too many, noting that for check().  This runs in the
+// destructor of DiagArgs, and so must not stop.
+//
+void DiagnosticEngine::commit()
+{
+    if (dedupe) {
+        const Diagnostic &d = diags.back();
+        std::string key = std::to_string(d.line) + '\x1f' + d.kind->code;
+        for (size_t i = 0; i < d.args.size(); i++)
+            key += '\x1f' + d.args[i];
+        if (!seen.insert(key).second) {
+            diags.pop_back();
+            return;
+        }
+    }
+    if (max_errors > 0 && (int) diags.size() > max_errors) {
+        diags.pop_back();
+        overflowed = true;
+    }
+}
+
+void DiagnosticEngine::check()
+{
+    if (!overflowed)
+        return;
+    overflowed = false;
+    flush();
+    if (format == DiagText)
+        fprintf(stderr, "More than %d errors\n", max_errors);
+    stop(1);
+}
+
+void DiagnosticEngine::append(DiagnosticEngine &other)
+{
+    for (size_t i = 0; i < other.diags.size(); i++) {
+        diags.push_back(other.diags[i]);
+        commit();
+    }
+    other.diags.clear();
+    other.seen.clear();
+    check();
+}
+
+std::string DiagnosticEngine::render(const Diagnostic &d) const
+{
+    std::string out;
+    for (const char *p = d.kind->format; *p; p++) {
+        if (*p == '{') {
+            const char *q = p + 1;
+            while (*q && *q != '}')
+                q++;
+            std::string name(p + 1, q - p - 1);
+            if (name == "line") {
+                out += std::to_string(d.line);
+                p = q;
+                continue;
+            }
+            if (!name.empty() && name.find_first_not_of("0123456789") == std::string::npos) {
+                size_t k = atoi(name.c_str());
+                if (k < d.args.size())
+                    out += d.args[k];
+                p = q;
+                continue;
+            }
+        }
+        out += *p;
+    }
+    return out;
+}
+
+static void json_string(std::string &out, const std::string &s)
+{
+    out += '"';
+    for (size_t i = 0; i < s.size(); i++) {
+        unsigned char c = s[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '\t') {
+            out += "\\t";
+        } else if (c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof buf, "\\u%04x", c);
+            out += buf;
+        } else
+            out += c;
+    }
+    out += '"';
+}
+
+void DiagnosticEngine::flush()
+{
+    std::string out;
+
+    if (format == DiagText) {
+        for (size_t i = 0; i < diags.size(); i++)
+            out += render(diags[i]);
+    } else if (!diags.empty()) {
+        out += "[\n";
+        for (size_t i = 0; i < diags.size(); i++) {
+            const Diagnostic &d = diags[i];
+            std::string message = render(d);
+            while (!message.empty() && message[message.size() - 1] == '\n')
+                message.erase(message.size() - 1);
+            out += "{\"line\": " + std::to_string(d.line) + ", \"code\": ";
+            json_string(out, d.kind->code);
+            out += ", \"args\": [";
+            for (size_t k = 0; k < d.args.size(); k++) {
+                if (k > 0)
+                    out += ", ";
+                json_string(out, d.args[k]);
+            }
+            out += "], \"message\": ";
+            json_string(out, message);
+            out += i + 1 < diags.size() ? "},\n" : "}\n";
+        }
+        out += "]\n";
+    }
+    diags.clear();
+
+    // one write, past the iostream buffers
+    fflush(stderr);
+    for (size_t done = 0; done < out.size(); ) {
+        ssize_t n = write(2, out.data() + done, out.size() - done);
+        if (n <= 0)
+            break;
+        done += n;
+    }
+}
+
+void DiagnosticEngine::halt(const char *why)
+{
+    check();
+    flush();
+    if (format == DiagText)
+        fprintf(stderr, "%s\n", why);
+    stop(1);
+}
+
+void DiagnosticEngine::stop(int status)
+{
+    if (recover) {
+        CompileHalted h = { status };
+        throw h;
+    }
+    exit(status);
+}
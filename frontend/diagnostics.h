@@ -0,0 +1,132 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _DIAGNOSTICS_H_
+#define _DIAGNOSTICS_H_
+
+#include <string>
+#include <vector>
+#include <set>
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Diagnostics
+//
+//  Errors are not written as they are found.  They are collected by a
+//  DiagnosticEngine as a line, a kind and the arguments of the message,
+//  and written out all at once by flush() or halt(), in one write to
+//  stderr.
+//
+//  A DiagKind names a kind of error and gives the text it is printed
+//  with: "{line}" is replaced by the line of the diagnostic and "{0}",
+//  "{1}", ... by its arguments, given with << after report():
+//
+//      static const DiagKind undefined_object =
+//          { "undefined-object", "{line}: object {0} has not been defined.\n" };
+//      diagnostics.report(line, undefined_object) << name;
+//
+//  format          DiagText prints the texts; DiagJson prints a JSON array
+//                  of objects with line, code, args and message
+//  dedupe          drop a diagnostic equal to an earlier one
+//  max_errors      at the next error after this many, flush these and
+//                  exit (0: no limit).  The error that goes over is only
+//                  noted, as it is complete in a destructor, which must
+//                  not throw; the next report(), halt() or check() stops
+//  recover         stop by throwing CompileHalted instead of exiting, for
+//                  a driver that goes on with the next file
+//
+//////////////////////////////////////////////////////////////////////////////
+
+struct DiagKind {
+    const char *code;
+    const char *format;
+};
+
+struct Diagnostic {
+    int line;
+    const DiagKind *kind;
+    std::vector<std::string> args;
+};
+
+enum DiagFormat { DiagText, DiagJson };
+
+// what stop() throws with recover set: the exit status it would give
+struct CompileHalted {
+    int status;
+};
+
+class DiagnosticEngine;
+
+//
+// What report() returns: collects the arguments of the diagnostic, which
+// is complete when this goes away at the end of the statement.
+//
+class DiagArgs {
+    DiagnosticEngine *engine;
+    Diagnostic *diag;
+public:
+    DiagArgs(DiagnosticEngine *e, Diagnostic *d) : engine(e), diag(d) { }
+    DiagArgs(const DiagArgs &) = delete;
+    ~DiagArgs();
+
+    DiagArgs &operator<<(const char *s) { diag->args.push_back(s); return *this; }
+    DiagArgs &operator<<(const std::string &s) { diag->args.push_back(s); return *this; }
+    DiagArgs &operator<<(int n) { diag->args.push_back(std::to_string(n)); return *this; }
+    template <class T> DiagArgs &operator<<(const T &v);
+};
+
+class DiagnosticEngine {
+    friend class DiagArgs;
+
+    std::vector<Diagnostic> diags;
+    std::set<std::string> seen;
+    bool overflowed;            // an error past max_errors was dropped
+
+    void commit();
+public:
+    DiagFormat format;
+    bool dedupe;
+    int max_errors;
+    bool recover;
+
+    DiagnosticEngine() : overflowed(false), format(DiagText), dedupe(false),
+                         max_errors(0), recover(false) { }
+
+    DiagArgs report(int line, const DiagKind &kind);
+    // take over the diagnostics of other, in order, and empty it
+    void append(DiagnosticEngine &other);
+    int count() const { return diags.size(); }
+    const std::vector<Diagnostic> &collected() const { return diags; }
+
+    // write out what has been collected and forget it
+    void flush();
+    // flush, in text say why, and exit(1)
+    void halt(const char *why);
+    // stop if there were more than max_errors errors
+    void check();
+    // exit(status), or throw CompileHalted with recover
+    void stop(int status);
+    // forget what was collected and seen, for the next file
+    void reset() { diags.clear(); seen.clear(); overflowed = false; }
+
+    std::string render(const Diagnostic &d) const;
+};
+
+// the engine of the phase; set up from the command line by handle_flags()
+extern DiagnosticEngine diagnostics;
+
+#include <sstream>
+
+template <class T> DiagArgs &DiagArgs::operator<<(const T &v)
+{
+    std::ostringstream s;
+    s << v;
+    diag->args.push_back(s.str());
+    return *this;
+}
+
+#endif
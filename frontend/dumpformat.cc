@@ -0,0 +1,509 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <unordered_map>
+#include "seal-decl.h"
+#include "seal-stmt.h"
+#include "seal-expr.h"
+#include "dumpformat.h"
+#include "dumpwriter.h"
+
+const char *const node_kind_names[NodeKinds] = {
+    "Program", "VariableDecl", "Variable", "CallDecl",
+    "StmtBlock", "IfStmt", "WhileStmt", "ForStmt", "BreakStmt",
+    "ContinueStmt", "ReturnStmt",
+    "Assign", "Add", "Minus", "Multi", "Divide", "Mod", "Neg",
+    "Lt", "Le", "Equ", "Neq", "Ge", "Gt", "And", "Or", "Xor", "Not",
+    "Bitand", "Bitor", "Bitnot", "Object", "Call", "Actual",
+    "Const_int", "Const_string", "Const_float", "Const_bool", "No_expr",
+    "IntToFloat",
+};
+
+const char *const node_field_names[NodeFields] = {
+    "decls", "variable", "parameters", "body", "variables", "statements",
+    "condition", "then", "else", "init", "loop", "value",
+    "left", "right", "operand", "actuals", "expr",
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  TreeEncoder
+//
+//////////////////////////////////////////////////////////////////////////////
+
+void TreeEncoder::begin(NodeKind kind, tree_node *t, Symbol type)
+{
+    write_pending();
+    Node &n = pending;
+    n.id = next_id++;
+    n.parent = -1;
+    n.field = FNone;
+    n.index = -1;
+    if (!open.empty()) {
+        Open &p = open.back();
+        n.parent = p.id;
+        n.field = p.field;
+        if (p.list)
+            n.index = p.count;
+        p.count++;
+    }
+    n.kind = kind;
+    n.line = t->get_line_number();
+    n.type = type;
+    n.nattrs = 0;
+    have_pending = true;
+    Open o = { n.id, FNone, false, 0 };
+    open.push_back(o);
+}
+
+void TreeEncoder::attr(const char *name, Symbol s)
+{
+    Attr a = { name, s, false };
+    pending.attrs[pending.nattrs++] = a;
+}
+
+void TreeEncoder::attr(const char *name, bool b)
+{
+    Attr a = { name, NULL, b };
+    pending.attrs[pending.nattrs++] = a;
+}
+
+void TreeEncoder::field(NodeField f, bool list)
+{
+    write_pending();
+    Open &o = open.back();
+    o.field = f;
+    o.list = list;
+    o.count = 0;
+}
+
+void TreeEncoder::end()
+{
+    write_pending();
+    write_end();
+    open.pop_back();
+}
+
+void TreeEncoder::finish()
+{
+    while (!open.empty())
+        end();
+}
+
+void TreeEncoder::write_pending()
+{
+    if (have_pending)
+        write_node(pending);
+    have_pending = false;
+}
+
+//
+// A list field: each element fills the field in turn.
+//
+template <class Elem>
+static void encode_list(TreeEncoder &e, NodeField f, list_node<Elem> *l)
+{
+    std::vector<Elem> elems;
+    l->collect(elems);
+    e.field(f, true);
+    for (Elem x : elems)
+        x->encode(e);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  JSON Lines
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class JsonEncoder : public TreeEncoder {
+    void number(long n);
+    void quote(const char *s, int len);
+    void symbol(Symbol s);
+protected:
+    void write_node(const Node &n);
+public:
+    JsonEncoder(ostream &s) : TreeEncoder(s) { }
+};
+
+void JsonEncoder::number(long n)
+{
+    char buf[24];
+    char *end = buf + sizeof buf;
+    char *p = format_int(end, n);
+    out.append(p, end - p);
+}
+
+void JsonEncoder::quote(const char *s, int len)
+{
+    out += '"';
+    for (int i = 0; i < len; i++) {
+        unsigned char c = s[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '\t') {
+            out += "\\t";
+        } else if (c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof buf, "\\u%04x", c);
+            out += buf;
+        } else
+            out += c;
+    }
+    out += '"';
+}
+
+void JsonEncoder::symbol(Symbol s)
+{
+    quote(s->get_string(), s->get_len());
+}
+
+void JsonEncoder::write_node(const Node &n)
+{
+    out += "{\"id\":";
+    number(n.id);
+    if (n.parent >= 0) {
+        out += ",\"parent\":";
+        number(n.parent);
+        out += ",\"field\":\"";
+        out += node_field_names[n.field];
+        out += '"';
+    }
+    if (n.index >= 0) {
+        out += ",\"index\":";
+        number(n.index);
+    }
+    out += ",\"kind\":\"";
+    out += node_kind_names[n.kind];
+    out += "\",\"line\":";
+    number(n.line);
+    if (n.type) {
+        out += ",\"type\":";
+        symbol(n.type);
+    }
+    for (int i = 0; i < n.nattrs; i++) {
+        out += ",\"";
+        out += n.attrs[i].name;
+        out += "\":";
+        if (n.attrs[i].sym)
+            symbol(n.attrs[i].sym);
+        else
+            out += n.attrs[i].flag ? "true" : "false";
+    }
+    out += "}\n";
+    put();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Binary
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class BinaryEncoder : public TreeEncoder {
+    std::unordered_map<Symbol, unsigned long> symbols;
+
+    void varint(unsigned long n);
+    unsigned long symbol(Symbol s);
+protected:
+    void write_node(const Node &n);
+    void write_end();
+public:
+    BinaryEncoder(ostream &s);
+};
+
+BinaryEncoder::BinaryEncoder(ostream &s) : TreeEncoder(s)
+{
+    out.append("SEALAST\1", 8);
+    put();
+}
+
+void BinaryEncoder::varint(unsigned long n)
+{
+    while (n >= 0x80) {
+        out += (char) (n | 0x80);
+        n >>= 7;
+    }
+    out += (char) n;
+}
+
+//
+// The number of s, defining it first if it is new.
+//
+unsigned long BinaryEncoder::symbol(Symbol s)
+{
+    if (s == NULL)
+        return 0;
+    unsigned long &number = symbols[s];
+    if (number == 0) {
+        number = symbols.size();
+        varint(1);
+        varint(s->get_len());
+        out.append(s->get_string(), s->get_len());
+    }
+    return number;
+}
+
+void BinaryEncoder::write_node(const Node &n)
+{
+    // the symbols are defined before the node
+    unsigned long type = symbol(n.type);
+    unsigned long attrs[2];
+    for (int i = 0; i < n.nattrs; i++)
+        attrs[i] = n.attrs[i].sym ? symbol(n.attrs[i].sym) : n.attrs[i].flag;
+
+    varint(n.kind + 2);
+    varint(n.field + 1);
+    varint(n.line < 0 ? 0 : n.line);
+    varint(type);
+    for (int i = 0; i < n.nattrs; i++)
+        varint(attrs[i]);
+    put();
+}
+
+void BinaryEncoder::write_end()
+{
+    varint(0);
+    put();
+}
+
+TreeEncoder *new_encoder(ostream &stream, int format)
+{
+    switch (format) {
+    case DumpJson:
+        return new JsonEncoder(stream);
+    case DumpBinary:
+        return new BinaryEncoder(stream);
+    default:
+        return NULL;
+    }
+}
+
+void dump_tree(ostream &stream, Program root, int format)
+{
+    TreeEncoder *e = new_encoder(stream, format);
+    if (e == NULL) {
+        root->dump_with_types(stream, 0);
+        return;
+    }
+    root->encode(*e);
+    e->finish();
+    delete e;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  encode() of each kind of node.  Expressions give their type; a
+//  Variable gives the type it is declared with.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+void Program_class::encode(TreeEncoder &e)
+{
+    e.begin(KProgram, this);
+    encode_list(e, FDecls, decls);
+    e.end();
+}
+
+void VariableDecl_class::encode(TreeEncoder &e)
+{
+    e.begin(KVariableDecl, this);
+    e.field(FVariable);
+    variable->encode(e);
+    e.end();
+}
+
+void Variable_class::encode(TreeEncoder &e)
+{
+    e.begin(KVariable, this, type);
+    e.attr("name", name);
+    e.end();
+}
+
+void CallDecl_class::encode(TreeEncoder &e)
+{
+    e.begin(KCallDecl, this);
+    e.attr("name", name);
+    e.attr("return_type", returnType);
+    encode_list(e, FParameters, paras);
+    e.field(FBody);
+    getBody()->encode(e);
+    e.end();
+}
+
+void StmtBlock_class::encode(TreeEncoder &e)
+{
+    e.begin(KStmtBlock, this);
+    encode_list(e, FVariables, vars);
+    encode_list(e, FStatements, stmts);
+    e.end();
+}
+
+void IfStmt_class::encode(TreeEncoder &e)
+{
+    e.begin(KIfStmt, this);
+    e.field(FCondition);
+    condition->encode(e);
+    e.field(FThen);
+    thenexpr->encode(e);
+    e.field(FElse);
+    elseexpr->encode(e);
+    e.end();
+}
+
+void WhileStmt_class::encode(TreeEncoder &e)
+{
+    e.begin(KWhileStmt, this);
+    e.field(FCondition);
+    condition->encode(e);
+    e.field(FBody);
+    body->encode(e);
+    e.end();
+}
+
+void ForStmt_class::encode(TreeEncoder &e)
+{
+    e.begin(KForStmt, this);
+    e.field(FInit);
+    initexpr->encode(e);
+    e.field(FCondition);
+    condition->encode(e);
+    e.field(FLoop);
+    loopact->encode(e);
+    e.field(FBody);
+    body->encode(e);
+    e.end();
+}
+
+void BreakStmt_class::encode(TreeEncoder &e)
+{
+    e.begin(KBreakStmt, this);
+    e.end();
+}
+
+void ContinueStmt_class::encode(TreeEncoder &e)
+{
+    e.begin(KContinueStmt, this);
+    e.end();
+}
+
+void ReturnStmt_class::encode(TreeEncoder &e)
+{
+    e.begin(KReturnStmt, this);
+    e.field(FValue);
+    value->encode(e);
+    e.end();
+}
+
+void Assign_class::encode(TreeEncoder &e)
+{
+    e.begin(KAssign, this, type);
+    e.attr("name", lvalue);
+    e.field(FValue);
+    value->encode(e);
+    e.end();
+}
+
+static void encode_binary(TreeEncoder &e, NodeKind kind, Expr_class *x,
+                          Expr e1, Expr e2)
+{
+    e.begin(kind, x, x->type);
+    e.field(FLeft);
+    e1->encode(e);
+    e.field(FRight);
+    e2->encode(e);
+    e.end();
+}
+
+static void encode_unary(TreeEncoder &e, NodeKind kind, Expr_class *x, Expr e1)
+{
+    e.begin(kind, x, x->type);
+    e.field(FOperand);
+    e1->encode(e);
+    e.end();
+}
+
+void Add_class::encode(TreeEncoder &e)    { encode_binary(e, KAdd, this, e1, e2); }
+void Minus_class::encode(TreeEncoder &e)  { encode_binary(e, KMinus, this, e1, e2); }
+void Multi_class::encode(TreeEncoder &e)  { encode_binary(e, KMulti, this, e1, e2); }
+void Divide_class::encode(TreeEncoder &e) { encode_binary(e, KDivide, this, e1, e2); }
+void Mod_class::encode(TreeEncoder &e)    { encode_binary(e, KMod, this, e1, e2); }
+void Neg_class::encode(TreeEncoder &e)    { encode_unary(e, KNeg, this, e1); }
+void Lt_class::encode(TreeEncoder &e)     { encode_binary(e, KLt, this, e1, e2); }
+void Le_class::encode(TreeEncoder &e)     { encode_binary(e, KLe, this, e1, e2); }
+void Equ_class::encode(TreeEncoder &e)    { encode_binary(e, KEqu, this, e1, e2); }
+void Neq_class::encode(TreeEncoder &e)    { encode_binary(e, KNeq, this, e1, e2); }
+void Ge_class::encode(TreeEncoder &e)     { encode_binary(e, KGe, this, e1, e2); }
+void Gt_class::encode(TreeEncoder &e)     { encode_binary(e, KGt, this, e1, e2); }
+void And_class::encode(TreeEncoder &e)    { encode_binary(e, KAnd, this, e1, e2); }
+void Or_class::encode(TreeEncoder &e)     { encode_binary(e, KOr, this, e1, e2); }
+void Xor_class::encode(TreeEncoder &e)    { encode_binary(e, KXor, this, e1, e2); }
+void Not_class::encode(TreeEncoder &e)    { encode_unary(e, KNot, this, e1); }
+void Bitand_class::encode(TreeEncoder &e) { encode_binary(e, KBitand, this, e1, e2); }
+void Bitor_class::encode(TreeEncoder &e)  { encode_binary(e, KBitor, this, e1, e2); }
+void Bitnot_class::encode(TreeEncoder &e) { encode_unary(e, KBitnot, this, e1); }
+void IntToFloat_class::encode(TreeEncoder &e) { encode_unary(e, KIntToFloat, this, e1); }
+
+void Object_class::encode(TreeEncoder &e)
+{
+    e.begin(KObject, this, type);
+    e.attr("name", var);
+    e.end();
+}
+
+void Call_class::encode(TreeEncoder &e)
+{
+    e.begin(KCall, this, type);
+    e.attr("name", name);
+    encode_list(e, FActuals, actuals);
+    e.end();
+}
+
+void Actual_class::encode(TreeEncoder &e)
+{
+    e.begin(KActual, this, type);
+    e.field(FExpr);
+    expr->encode(e);
+    e.end();
+}
+
+void Const_int_class::encode(TreeEncoder &e)
+{
+    e.begin(KConst_int, this, type);
+    e.attr("value", value);
+    e.end();
+}
+
+void Const_string_class::encode(TreeEncoder &e)
+{
+    e.begin(KConst_string, this, type);
+    e.attr("value", value);
+    e.end();
+}
+
+void Const_float_class::encode(TreeEncoder &e)
+{
+    e.begin(KConst_float, this, type);
+    e.attr("value", value);
+    e.end();
+}
+
+void Const_bool_class::encode(TreeEncoder &e)
+{
+    e.begin(KConst_bool, this, type);
+    e.attr("value", value != 0);
+    e.end();
+}
+
+void No_expr_class::encode(TreeEncoder &e)
+{
+    e.begin(KNo_expr, this, type);
+    e.end();
+}
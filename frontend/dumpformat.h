@@ -0,0 +1,140 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _DUMPFORMAT_H_
+#define _DUMPFORMAT_H_
+
+#include <string>
+#include <vector>
+#include "seal-tree.handcode.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Dump formats
+//
+//  Besides the indented text of dump_with_types, a tree can be dumped for
+//  other programs to read (-f json, -f binary):
+//
+//  json    JSON Lines, one object per node in preorder.  A node has an id
+//          (its place in the preorder), the id of its parent, the field of
+//          the parent it is in and, in a list, its index there; then its
+//          kind, line, type (if it has one) and attributes.  The objects
+//          are described by ast-dump.schema.json.
+//
+//  binary  The same nodes as a stream of records of unsigned LEB128
+//          varints, after the 8 bytes "SEALAST\1":
+//
+//            0                 ends the innermost node not yet ended
+//            1 len bytes       the next symbol, numbered 1, 2, ... in the
+//                              order they appear
+//            kind+2 field line type attributes...
+//                              a node; its children follow, then its 0
+//
+//          field is 0 for the root and field+1 otherwise, type 0 for none
+//          and else a symbol number.  The attributes are fixed by the kind
+//          (see encode() in dumpformat.cc): a symbol number for each
+//          symbol and 0 or 1 for a boolean.  A symbol is always defined
+//          before the node that uses it.
+//
+//  Each node class has encode(), which tells a TreeEncoder what the node
+//  is made of: begin() with its kind, the attributes, field() before the
+//  children in each of its fields and end().  The encoder puts this in
+//  its format.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+enum DumpFormat { DumpText, DumpJson, DumpBinary };
+
+// The kinds of node; the number of a kind is part of the binary format,
+// so new kinds go at the end.
+enum NodeKind {
+    KProgram, KVariableDecl, KVariable, KCallDecl,
+    KStmtBlock, KIfStmt, KWhileStmt, KForStmt, KBreakStmt,
+    KContinueStmt, KReturnStmt,
+    KAssign, KAdd, KMinus, KMulti, KDivide, KMod, KNeg,
+    KLt, KLe, KEqu, KNeq, KGe, KGt, KAnd, KOr, KXor, KNot,
+    KBitand, KBitor, KBitnot, KObject, KCall, KActual,
+    KConst_int, KConst_string, KConst_float, KConst_bool, KNo_expr,
+    KIntToFloat,
+    NodeKinds
+};
+
+// The fields a node can be in; numbered like the kinds.
+enum NodeField {
+    FDecls, FVariable, FParameters, FBody, FVariables, FStatements,
+    FCondition, FThen, FElse, FInit, FLoop, FValue,
+    FLeft, FRight, FOperand, FActuals, FExpr,
+    NodeFields,
+    FNone = -1          // the root
+};
+
+extern const char *const node_kind_names[NodeKinds];
+extern const char *const node_field_names[NodeFields];
+
+class TreeEncoder {
+protected:
+    struct Attr {
+        const char *name;
+        Symbol sym;         // NULL for a boolean
+        bool flag;
+    };
+
+    // a node begun and not written yet, until its first field or end
+    struct Node {
+        long id, parent;
+        NodeField field;
+        long index;         // in a list field, else -1
+        NodeKind kind;
+        int line;
+        Symbol type;
+        Attr attrs[2];
+        int nattrs;
+    };
+
+    ostream &stream;
+    std::string out;        // what is written next
+
+    virtual void write_node(const Node &n) = 0;
+    virtual void write_end() { }
+    void put() { stream.write(out.data(), out.size()); out.clear(); }
+
+private:
+    struct Open {
+        long id;
+        NodeField field;
+        bool list;
+        long count;         // of the nodes in the field so far
+    };
+
+    std::vector<Open> open;
+    Node pending;
+    bool have_pending;
+    long next_id;
+
+    void write_pending();
+public:
+    TreeEncoder(ostream &s) : stream(s), have_pending(false), next_id(0) { }
+    virtual ~TreeEncoder() { }
+
+    void begin(NodeKind kind, tree_node *t, Symbol type = NULL);
+    void attr(const char *name, Symbol s);
+    void attr(const char *name, bool b);
+    void field(NodeField f, bool list = false);
+    void end();
+
+    // ends every node still open: the root of a tree dumped a
+    // declaration at a time
+    void finish();
+};
+
+// an encoder for format on stream; NULL for DumpText
+TreeEncoder *new_encoder(ostream &stream, int format);
+
+// dumps a whole tree in format
+void dump_tree(ostream &stream, Program root, int format);
+
+#endif
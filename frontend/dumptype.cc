@@ -10,6 +10,11 @@
 #include "seal-stmt.h"
 #include "seal-expr.h"
 #include "utilities.h"
+#include "dumpwriter.h"
+#include "workpool.h"
+#include <string.h>
+#include <sstream>
+#include <thread>
 
 // defined in stringtab.cc
 void dump_Symbol(ostream& stream, int padding, Symbol b); 
@@ -17,6 +22,9 @@ void dump_Symbol(ostream& stream, int padding, Symbol b);
 // defined in seal.h
 void dump_Boolean(ostream& stream, int padding, Boolean b);
 
+// defined in handle_flags.cc
+extern int jobs;
+
 //////////////////////////////////////////////////////////////////
 //
 //  dumptype.cc
@@ -117,31 +125,58 @@ void dump_Boolean(ostream& stream, int padding, Boolean b);
 void Expr_class::dump_type(ostream& stream, int n)
 {
   if (type)
-    { stream << pad(n) << ": " << type << endl; }
+    { stream << pad(n) << ": " << type << "\n"; }
   else
-    { stream << pad(n) << ": _no_type" << endl; }
+    { stream << pad(n) << ": _no_type\n"; }
 }
 
 
 void Call_class::dump_type(ostream& stream, int n)
 {
   if (type)
-    { stream << pad(n) << ": " << type << endl; }
+    { stream << pad(n) << ": " << type << "\n"; }
   else
-    { stream << pad(n) << ": _no_type" << endl; }
+    { stream << pad(n) << ": _no_type\n"; }
 }
 
 void Actual_class::dump_type(ostream& stream, int n)
 {
   if (type)
-    { stream << pad(n) << ": " << type << endl; }
+    { stream << pad(n) << ": " << type << "\n"; }
   else
-    { stream << pad(n) << ": _no_type" << endl; }
+    { stream << pad(n) << ": _no_type\n"; }
 }
 
+//
+//  dump_line writes the line marker of a node, the most frequent line of
+//  a dump: the padding, "#" and the line number are put together in a
+//  buffer and written at once.
+//
 void dump_line(ostream& stream, int n, tree_node *t)
 {
-  stream << pad(n) << "#" << t->get_line_number() << "\n";
+  char buf[128];
+  char *end = buf + sizeof buf;
+  char *p = format_int(end - 1, t->get_line_number());
+  int width = n <= 0 ? 0 : n > 80 ? 80 : n;   // as much as pad(n) gives
+
+  end[-1] = '\n';
+  *--p = '#';
+  p -= width;
+  memcpy(p, pad(n), width);
+  stream.write(p, end - p);
+}
+
+//
+//  dump_list dumps each element of a list.  It walks the list once;
+//  stepping through it with nth() walks it again for every element.
+//
+template <class Elem>
+static void dump_list(ostream& stream, int n, list_node<Elem> *l)
+{
+   std::vector<Elem> elems;
+   l->collect(elems);
+   for (Elem e : elems)
+      e->dump_with_types(stream, n);
 }
 
 //
@@ -151,18 +186,43 @@ void dump_line(ostream& stream, int n, tree_node *t)
 //  "classes->nth(i)->dump_with_types(...)" shows how useful
 //  and compact virtual functions are for this kind of computation.
 //
-//  Note the use of the iterator to cycle through all of the
-//  classes.  The methods first, more, next, and nth on AST lists
-//  are defined in tree.h.
+//  The declarations are walked with dump_list, above; the list
+//  methods it uses are defined in tree.h.
 //
+//  With more than one thread (-j), the dump of a declaration depends only
+//  on its own subtree, so the declarations are dumped in parallel, each
+//  into a buffer of its own, and the buffers are written in order: the
+//  output is the same.  This is done dump_window declarations at a time,
+//  to keep only that much of the dump in memory.
+//
+static const int dump_window = 256;
+
 void Program_class::dump_with_types(ostream& stream, int n)
 {
    dump_line(stream,n,this);
    stream << pad(n) << "Program\n";
-   for(int i = decls->first(); decls->more(i); i = decls->next(i)){
-      decls->nth(i)->dump_with_types(stream, n+2);
+
+   int threads = jobs > 0 ? jobs : std::thread::hardware_concurrency();
+   std::vector<Decl> elems;
+   decls->collect(elems);
+   if (threads <= 1 || elems.size() < 2) {
+      for (Decl d : elems)
+         d->dump_with_types(stream, n+2);
+      return;
+   }
+
+   std::vector<std::string> text;
+   for (size_t lo = 0; lo < elems.size(); lo += dump_window) {
+      int count = std::min(elems.size() - lo, (size_t) dump_window);
+      text.assign(count, std::string());
+      run_parallel(count, threads, [&](int i) {
+         std::ostringstream s;
+         elems[lo + i]->dump_with_types(s, n+2);
+         text[i] = s.str();
+      });
+      for (int i = 0; i < count; i++)
+         stream.write(text[i].data(), text[i].size());
    }
-     
 }
 
 void VariableDecl_class::dump_with_types(ostream& stream, int n)
@@ -191,13 +251,12 @@ void CallDecl_class::dump_with_types(ostream& stream, int n)
    dump_Symbol(stream, n+2, name);
    stream << pad(n+2) << "(parameters)\n";
    stream << pad(n+2) << "(\n";
-   for(int i = paras->first(); paras->more(i); i = paras->next(i))
-     paras->nth(i)->dump_with_types(stream, n+2);
+   dump_list(stream, n+2, paras);
    stream << pad(n+2) << ")\n";
    stream << pad(n+2) << "(return type)\n";
    dump_Symbol(stream, n+2, returnType);
    stream << pad(n+2) << "(body)\n";
-   body->dump_with_types(stream, n+2);
+   getBody()->dump_with_types(stream, n+2);
    
 }
 
@@ -207,13 +266,11 @@ void StmtBlock_class::dump_with_types(ostream& stream, int n)
    stream << pad(n) << "Statement Block\n";
    stream << pad(n+2) << "(variable declarations)\n";
    stream << pad(n+2) << "(\n";
-   for(int i = vars->first(); vars->more(i); i = vars->next(i))
-     vars->nth(i)->dump_with_types(stream, n+2);
+   dump_list(stream, n+2, vars);
    stream << pad(n+2) << ")\n";
    stream << pad(n+2) << "(statements)\n";
    stream << pad(n+2) << "(\n";
-   for(int i = stmts->first(); stmts->more(i); i = stmts->next(i))
-     stmts->nth(i)->dump_with_types(stream, n+2);
+   dump_list(stream, n+2, stmts);
    stream << pad(n+2) << ")\n";
 }
 
@@ -481,6 +538,16 @@ void Bitnot_class::dump_with_types(ostream& stream, int n)
    stream << pad(n+2) << "(type)\n";
 }
 
+void IntToFloat_class::dump_with_types(ostream& stream, int n)
+{
+   dump_line(stream,n,this);
+   stream << pad(n) << "IntToFloat\n";
+   stream << pad(n+2) << "(OP)\n";
+   e1->dump_with_types(stream, n+2);
+   stream << pad(n+2) << "(type)\n";
+   dump_type(stream,n);
+}
+
 void Object_class::dump_with_types(ostream& stream, int n)
 {
    dump_line(stream,n,this);
@@ -500,8 +567,7 @@ void Call_class::dump_with_types(ostream& stream, int n)
    dump_Symbol(stream, n+2, name);
    stream << pad(n+2) << "(actual parameters)\n";
    stream << pad(n+2) << "(\n";
-   for(int i = actuals->first(); actuals->more(i); i = actuals->next(i))
-     actuals->nth(i)->dump_with_types(stream, n+2);
+   dump_list(stream, n+2, actuals);
    stream << pad(n+2) << ")\n";
    stream << pad(n+2) << "(type)\n";
    dump_type(stream,n);
@@ -0,0 +1,92 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <algorithm>
+#include "dumpwriter.h"
+
+static std::vector<DumpBuffer *> open_buffers;
+
+static void write_open_buffers()
+{
+    for (DumpBuffer *b : open_buffers)
+        b->pubsync();
+}
+
+DumpBuffer::DumpBuffer(int f, size_t size) : fd(f), buffer(size)
+{
+    setp(buffer.data(), buffer.data() + buffer.size());
+    static bool registered = false;
+    if (!registered)
+        atexit(write_open_buffers);
+    registered = true;
+    open_buffers.push_back(this);
+}
+
+DumpBuffer::~DumpBuffer()
+{
+    sync();
+    open_buffers.erase(std::find(open_buffers.begin(), open_buffers.end(), this));
+}
+
+bool DumpBuffer::write_out()
+{
+    const char *p = pbase();
+    while (p < pptr()) {
+        ssize_t n = ::write(fd, p, pptr() - p);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+    }
+    setp(buffer.data(), buffer.data() + buffer.size());
+    return true;
+}
+
+DumpBuffer::int_type DumpBuffer::overflow(int_type c)
+{
+    if (!write_out())
+        return traits_type::eof();
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+        return sputc(traits_type::to_char_type(c));
+    return traits_type::not_eof(c);
+}
+
+int DumpBuffer::sync()
+{
+    return write_out() ? 0 : -1;
+}
+
+//
+// Two digits at a time, from a table of 00 to 99.
+//
+static const char digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+char *format_int(char *end, long n)
+{
+    unsigned long u = n < 0 ? 0UL - (unsigned long) n : n;
+    char *p = end;
+    while (u >= 100) {
+        const char *d = digit_pairs + 2 * (u % 100);
+        u /= 100;
+        *--p = d[1];
+        *--p = d[0];
+    }
+    if (u >= 10) {
+        *--p = digit_pairs[2 * u + 1];
+        *--p = digit_pairs[2 * u];
+    } else
+        *--p = '0' + u;
+    if (n < 0)
+        *--p = '-';
+    return p;
+}
@@ -0,0 +1,58 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _DUMPWRITER_H_
+#define _DUMPWRITER_H_
+
+#include <vector>
+#include "seal-io.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  DumpWriter
+//
+//  The stream a tree is dumped to.  What is written collects in one
+//  large buffer, which goes to the file descriptor only when it is full,
+//  on flush(), and when the writer is destroyed; a dump of millions of
+//  lines is a few hundred write()s.  Nothing in the dump flushes per
+//  line, so the output is the same bytes as through cout.
+//
+//  Anything written to cout before must be flushed first, since both end
+//  up on the same descriptor.  A writer still open when the program
+//  exits, as on a fatal error in the middle of a dump, is written out
+//  then.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class DumpBuffer : public std::streambuf {
+    int fd;
+    std::vector<char> buffer;
+    bool write_out();
+protected:
+    int_type overflow(int_type c);
+    int sync();
+public:
+    DumpBuffer(int fd, size_t size);
+    ~DumpBuffer();
+};
+
+class DumpWriter : public std::ostream {
+    DumpBuffer buf;
+public:
+    explicit DumpWriter(int fd, size_t size = 1 << 20)
+        : std::ostream(NULL), buf(fd, size) { rdbuf(&buf); }
+    ~DumpWriter() { flush(); }
+};
+
+//
+// Writes the decimal digits of n to the characters before end and
+// returns where they start: the text of a line number without going
+// through the locale of a stream.
+//
+char *format_int(char *end, long n);
+
+#endif
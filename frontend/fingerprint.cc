@@ -0,0 +1,224 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include "seal.h"
+#include "tree.h"
+#include "seal-decl.h"
+#include "seal-stmt.h"
+#include "seal-expr.h"
+#include "fingerprint.h"
+
+//////////////////////////////////////////////////////////////////
+//
+//  fingerprint.cc
+//
+//  fingerprint(f) adds a node and everything below it to the hash in f:
+//  a tag naming the kind of node and its line, then its symbols, then its
+//  children in order.  A symbol and a list add their length first, so
+//  that two different trees do not add the same words.
+//
+//////////////////////////////////////////////////////////////////
+
+void Fingerprint::node(tree_node *t, char tag)
+{
+    nodes++;
+    hash.add((unsigned long long) (unsigned char) tag << 32 |
+             (unsigned) (t->get_line_number() - base_line));
+}
+
+void CallDecl_class::fingerprint(Fingerprint &f)
+{
+    f.base_line = get_line_number();
+    f.node(this, 'F');
+    f.symbol(name);
+    f.symbol(returnType);
+    f.count(paras->len());
+    for (int i = paras->first(); paras->more(i); i = paras->next(i))
+        paras->nth(i)->fingerprint(f);
+    body->fingerprint(f);
+}
+
+void Variable_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'v');
+    f.symbol(name);
+    f.symbol(type);
+}
+
+void VariableDecl_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'V');
+    variable->fingerprint(f);
+}
+
+void StmtBlock_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, '{');
+    f.count(vars->len());
+    for (int i = vars->first(); vars->more(i); i = vars->next(i))
+        vars->nth(i)->fingerprint(f);
+    f.count(stmts->len());
+    for (int i = stmts->first(); stmts->more(i); i = stmts->next(i))
+        stmts->nth(i)->fingerprint(f);
+}
+
+void IfStmt_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'i');
+    condition->fingerprint(f);
+    thenexpr->fingerprint(f);
+    elseexpr->fingerprint(f);
+}
+
+void WhileStmt_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'w');
+    condition->fingerprint(f);
+    body->fingerprint(f);
+}
+
+void ForStmt_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'f');
+    initexpr->fingerprint(f);
+    condition->fingerprint(f);
+    loopact->fingerprint(f);
+    body->fingerprint(f);
+}
+
+void ReturnStmt_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'r');
+    value->fingerprint(f);
+}
+
+void ContinueStmt_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'c');
+}
+
+void BreakStmt_class::fingerprint(Fingerprint &f)
+{
+    f.node(this, 'b');
+}
+
+void Call_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, '(');
+    f.symbol(name);
+    f.callees.push_back(name);
+    f.count(actuals->len());
+    for (int i = actuals->first(); actuals->more(i); i = actuals->next(i))
+        actuals->nth(i)->fingerprint(f);
+}
+
+void Actual_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'a');
+    expr->fingerprint(f);
+}
+
+void Assign_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, '=');
+    f.symbol(lvalue);
+    f.names.push_back(lvalue);
+    f.bindings.push_back(&binding);
+    value->fingerprint(f);
+}
+
+static void binary(Fingerprint &f, Expr e, char tag, Expr e1, Expr e2)
+{
+    f.expr(e, tag);
+    e1->fingerprint(f);
+    e2->fingerprint(f);
+}
+
+// an operator that takes an Int with a Float
+static void numeric(Fingerprint &f, Expr e, char tag, Expr &e1, Expr &e2)
+{
+    f.operands.push_back(&e1);
+    f.operands.push_back(&e2);
+    binary(f, e, tag, e1, e2);
+}
+
+void Add_class::fingerprint(Fingerprint &f) { numeric(f, this, '+', e1, e2); }
+void Minus_class::fingerprint(Fingerprint &f) { numeric(f, this, '-', e1, e2); }
+void Multi_class::fingerprint(Fingerprint &f) { numeric(f, this, '*', e1, e2); }
+void Divide_class::fingerprint(Fingerprint &f) { numeric(f, this, '/', e1, e2); }
+void Mod_class::fingerprint(Fingerprint &f) { binary(f, this, '%', e1, e2); }
+void Lt_class::fingerprint(Fingerprint &f) { numeric(f, this, '<', e1, e2); }
+void Le_class::fingerprint(Fingerprint &f) { numeric(f, this, 'l', e1, e2); }
+void Equ_class::fingerprint(Fingerprint &f) { numeric(f, this, 'e', e1, e2); }
+void Neq_class::fingerprint(Fingerprint &f) { numeric(f, this, 'n', e1, e2); }
+void Ge_class::fingerprint(Fingerprint &f) { numeric(f, this, 'g', e1, e2); }
+void Gt_class::fingerprint(Fingerprint &f) { numeric(f, this, '>', e1, e2); }
+void And_class::fingerprint(Fingerprint &f) { binary(f, this, 'A', e1, e2); }
+void Or_class::fingerprint(Fingerprint &f) { binary(f, this, 'O', e1, e2); }
+void Xor_class::fingerprint(Fingerprint &f) { binary(f, this, '^', e1, e2); }
+void Bitand_class::fingerprint(Fingerprint &f) { binary(f, this, '&', e1, e2); }
+void Bitor_class::fingerprint(Fingerprint &f) { binary(f, this, '|', e1, e2); }
+
+void Neg_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'N');
+    e1->fingerprint(f);
+}
+
+void Not_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, '!');
+    e1->fingerprint(f);
+}
+
+void Bitnot_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, '~');
+    e1->fingerprint(f);
+}
+
+void IntToFloat_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'C');
+    e1->fingerprint(f);
+}
+
+void Const_int_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'I');
+    f.symbol(value);
+}
+
+void Const_string_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'S');
+    f.symbol(value);
+}
+
+void Const_float_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'D');
+    f.symbol(value);
+}
+
+void Const_bool_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'B');
+    f.count(value);
+}
+
+void Object_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, 'o');
+    f.symbol(var);
+    f.names.push_back(var);
+    f.bindings.push_back(&binding);
+}
+
+void No_expr_class::fingerprint(Fingerprint &f)
+{
+    f.expr(this, '0');
+}
@@ -0,0 +1,59 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _FINGERPRINT_H_
+#define _FINGERPRINT_H_
+
+#include <vector>
+#include "seal-expr.h"
+#include "semcache.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Fingerprint
+//
+//  What the check of one function reads from its own tree, gathered by
+//  CallDecl_class::fingerprint() (fingerprint.cc):
+//
+//  hash            the hash of the tree: every node, symbol and constant,
+//                  and the line of each node relative to base_line, so
+//                  that a function which only moved hashes the same
+//  exprs           every expression, in tree order
+//  bindings        the binding of every Object and Assign, in tree order
+//  names           the variable named by each of bindings
+//  callees         the functions called, including repeats
+//  operands        the two operands of every arithmetic operator and
+//                  comparison, in tree order, where restoring the
+//                  check converts an Int met by a Float
+//  nodes           the number of nodes
+//
+//  Two functions with the same tree give the same errors at the same
+//  relative lines and the same types to their expressions, as long as the
+//  globals in names and the signatures of the callees are the same too.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+class Fingerprint {
+public:
+    int base_line;
+    int nodes;
+    CacheHasher hash;
+    std::vector<Expr> exprs;
+    std::vector<Binding **> bindings;
+    std::vector<Symbol> names;
+    std::vector<Symbol> callees;
+    std::vector<Expr *> operands;
+
+    Fingerprint() : base_line(0), nodes(0) { }
+
+    void node(tree_node *t, char tag);
+    void expr(Expr e, char tag) { exprs.push_back(e); node(e, tag); }
+    void symbol(Symbol s) { hash.add(s->get_string(), s->get_len()); }
+    void count(int n) { hash.add((unsigned long long) n); }   // a length, a slot, ...
+};
+
+#endif
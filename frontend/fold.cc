@@ -0,0 +1,380 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <limits.h>
+#include <vector>
+#include "seal.h"
+#include "tree.h"
+#include "seal-decl.h"
+#include "seal-stmt.h"
+#include "seal-expr.h"
+#include "fold.h"
+
+//////////////////////////////////////////////////////////////////
+//
+//  fold.cc
+//
+//  fold_Expr(f) folds the children of a node, then the node itself
+//  when they allow it, and returns what is left in its place.
+//
+//////////////////////////////////////////////////////////////////
+
+//
+// Constants
+//
+
+bool Const_int_class::constant(FoldValue &v)
+{
+    char *end;
+    errno = 0;
+    v.kind = FoldValue::Int;
+    v.i = strtoll(value->get_string(), &end, 10);
+    return errno == 0 && *end == '\0';
+}
+
+bool Const_float_class::constant(FoldValue &v)
+{
+    char *end;
+    errno = 0;
+    v.kind = FoldValue::Float;
+    v.f = strtod(value->get_string(), &end);
+    return errno == 0 && *end == '\0' && isfinite(v.f);
+}
+
+bool Const_bool_class::constant(FoldValue &v)
+{
+    v.kind = FoldValue::Bool;
+    v.i = value != 0;
+    return true;
+}
+
+//
+// The literal for a Float: the shortest decimal that reads back as the
+// same double, written out in the x.x form of the language.
+//
+static std::string float_literal(double d)
+{
+    char buf[400];
+    int digits = 1;
+    for (; digits < 17; digits++) {
+        snprintf(buf, sizeof buf, "%.*e", digits - 1, d);
+        if (strtod(buf, NULL) == d)
+            break;
+    }
+    snprintf(buf, sizeof buf, "%.*e", digits - 1, d);
+    int exponent = atoi(strchr(buf, 'e') + 1);
+    int decimals = digits - 1 - exponent;
+    snprintf(buf, sizeof buf, "%.*f", decimals > 1 ? decimals : 1, d);
+    return buf;
+}
+
+Expr Folder::constant(Expr e, const FoldValue &v)
+{
+    Expr k;
+    switch (v.kind) {
+    case FoldValue::Int: {
+        Symbol &s = ints[v.i];
+        if (s == NULL) {
+            char buf[24];
+            snprintf(buf, sizeof buf, "%lld", v.i);
+            s = inttable.add_string(buf);
+        }
+        k = const_int(e->get_line_number(), s);
+        break;
+    }
+    case FoldValue::Float: {
+        if (!isfinite(v.f))
+            return NULL;
+        std::string text = float_literal(v.f);
+        Symbol &s = floats[text];
+        if (s == NULL)
+            s = floattable.add_string((char *) text.c_str());
+        k = const_float(e->get_line_number(), s);
+        break;
+    }
+    default:
+        k = const_bool(e->get_line_number(), v.i != 0);
+        break;
+    }
+    return k->setType(e->getType());
+}
+
+//
+// Evaluating an operator on constants.  An Int with a Float is converted
+// to a Float first, as the type checker has it; Int arithmetic wraps.
+//
+
+enum FoldOp {
+    FAdd, FMinus, FMulti, FDivide, FMod,
+    FLt, FLe, FGe, FGt, FEqu, FNeq,
+    FAnd, FOr, FXor, FBitand, FBitor,
+    FNeg, FNot, FBitnot, FIntToFloat
+};
+
+static long long wrap(unsigned long long u) { return (long long) u; }
+
+static bool evaluate(FoldOp op, const FoldValue &a, const FoldValue &b, FoldValue &r)
+{
+    typedef unsigned long long U;
+    bool ints = a.kind == FoldValue::Int && b.kind == FoldValue::Int;
+    bool numbers = a.kind != FoldValue::Bool && b.kind != FoldValue::Bool;
+    double x = a.number(), y = b.number();
+
+    r.kind = FoldValue::Bool;
+    switch (op) {
+    case FLt: r.i = numbers && (ints ? a.i < b.i : x < y); return numbers;
+    case FLe: r.i = numbers && (ints ? a.i <= b.i : x <= y); return numbers;
+    case FGe: r.i = numbers && (ints ? a.i >= b.i : x >= y); return numbers;
+    case FGt: r.i = numbers && (ints ? a.i > b.i : x > y); return numbers;
+    case FEqu: r.i = numbers && !ints ? x == y : a.i == b.i; return true;
+    case FNeq: r.i = numbers && !ints ? x != y : a.i != b.i; return true;
+    case FAnd: r.i = a.i && b.i; return a.kind == FoldValue::Bool;
+    case FOr: r.i = a.i || b.i; return a.kind == FoldValue::Bool;
+    default: break;
+    }
+
+    if (!numbers && op != FXor)
+        return false;
+    if (!ints && op != FXor) {
+        r.kind = FoldValue::Float;
+        switch (op) {
+        case FAdd: r.f = x + y; break;
+        case FMinus: r.f = x - y; break;
+        case FMulti: r.f = x * y; break;
+        case FDivide: r.f = x / y; break;
+        default: return false;
+        }
+        return isfinite(r.f);
+    }
+
+    r.kind = a.kind;
+    switch (op) {
+    case FAdd: r.i = wrap((U) a.i + (U) b.i); return true;
+    case FMinus: r.i = wrap((U) a.i - (U) b.i); return true;
+    case FMulti: r.i = wrap((U) a.i * (U) b.i); return true;
+    case FDivide:
+    case FMod:
+        // these trap when the program runs; leave them to do so
+        if (b.i == 0 || (a.i == LLONG_MIN && b.i == -1))
+            return false;
+        r.i = op == FDivide ? a.i / b.i : a.i % b.i;
+        return true;
+    case FXor: r.i = a.i ^ b.i; return a.kind == b.kind;
+    case FBitand: r.i = a.i & b.i; return true;
+    case FBitor: r.i = a.i | b.i; return true;
+    default: return false;
+    }
+}
+
+static bool evaluate(FoldOp op, const FoldValue &a, FoldValue &r)
+{
+    r = a;
+    switch (op) {
+    case FNeg:
+        if (a.kind == FoldValue::Float)
+            r.f = -a.f;
+        else
+            r.i = wrap(0ULL - (unsigned long long) a.i);
+        return a.kind != FoldValue::Bool;
+    case FNot: r.i = !a.i; return a.kind == FoldValue::Bool;
+    case FBitnot: r.i = ~a.i; return a.kind == FoldValue::Int;
+    case FIntToFloat:
+        r.kind = FoldValue::Float;
+        r.f = (double) a.i;
+        return a.kind == FoldValue::Int;
+    default: return false;
+    }
+}
+
+//
+// Algebraic identities: an operand that leaves the other one unchanged,
+// on the side(s) where it does.  x + 0.0 is not x when x is -0.0, so
+// the identities of + hold for Int only.  The operand kept must have the
+// type of the whole, so that x * 1.0 with an Int x stays.
+//
+
+static bool is(const FoldValue &k, double n)
+{
+    return k.kind != FoldValue::Bool && k.number() == n;
+}
+
+static bool identity(FoldOp op, const FoldValue &k, bool on_left, bool is_int)
+{
+    switch (op) {
+    case FAdd: return is_int && is(k, 0);
+    case FMinus: return !on_left && is(k, 0);
+    case FMulti: return is(k, 1);
+    case FDivide: return !on_left && is(k, 1);
+    case FAnd: return k.kind == FoldValue::Bool && k.i == 1;
+    case FOr: return k.kind == FoldValue::Bool && k.i == 0;
+    case FXor: return k.kind == FoldValue::Bool ? k.i == 0 : is(k, 0);
+    case FBitor: return is(k, 0);
+    case FBitand: return is(k, -1);
+    default: return false;
+    }
+}
+
+static Expr binary(Folder &f, Expr e, FoldOp op, Expr &e1, Expr &e2)
+{
+    e1 = e1->fold_Expr(f);
+    e2 = e2->fold_Expr(f);
+
+    FoldValue a, b, r;
+    bool c1 = e1->constant(a), c2 = e2->constant(b);
+    if (c1 && c2) {
+        Expr k = evaluate(op, a, b, r) ? f.constant(e, r) : NULL;
+        if (k == NULL)
+            return e;
+        f.folded++;
+        return k;
+    }
+
+    // false && x and true || x do not evaluate x
+    if (c1 && a.kind == FoldValue::Bool &&
+        ((op == FAnd && !a.i) || (op == FOr && a.i))) {
+        f.folded++;
+        return e1;
+    }
+
+    if (c1 != c2) {
+        Expr x = c1 ? e2 : e1;
+        if (x->getType() == e->getType() &&
+            identity(op, c1 ? a : b, c1, x->getType() == f.Int)) {
+            f.simplified++;
+            return x;
+        }
+    }
+    return e;
+}
+
+static Expr unary(Folder &f, Expr e, FoldOp op, Expr &e1)
+{
+    e1 = e1->fold_Expr(f);
+
+    FoldValue a, r;
+    if (!e1->constant(a) || !evaluate(op, a, r))
+        return e;
+    Expr k = f.constant(e, r);
+    if (k == NULL)
+        return e;
+    f.folded++;
+    return k;
+}
+
+Expr Add_class::fold_Expr(Folder &f) { return binary(f, this, FAdd, e1, e2); }
+Expr Minus_class::fold_Expr(Folder &f) { return binary(f, this, FMinus, e1, e2); }
+Expr Multi_class::fold_Expr(Folder &f) { return binary(f, this, FMulti, e1, e2); }
+Expr Divide_class::fold_Expr(Folder &f) { return binary(f, this, FDivide, e1, e2); }
+Expr Mod_class::fold_Expr(Folder &f) { return binary(f, this, FMod, e1, e2); }
+Expr Lt_class::fold_Expr(Folder &f) { return binary(f, this, FLt, e1, e2); }
+Expr Le_class::fold_Expr(Folder &f) { return binary(f, this, FLe, e1, e2); }
+Expr Equ_class::fold_Expr(Folder &f) { return binary(f, this, FEqu, e1, e2); }
+Expr Neq_class::fold_Expr(Folder &f) { return binary(f, this, FNeq, e1, e2); }
+Expr Ge_class::fold_Expr(Folder &f) { return binary(f, this, FGe, e1, e2); }
+Expr Gt_class::fold_Expr(Folder &f) { return binary(f, this, FGt, e1, e2); }
+Expr And_class::fold_Expr(Folder &f) { return binary(f, this, FAnd, e1, e2); }
+Expr Or_class::fold_Expr(Folder &f) { return binary(f, this, FOr, e1, e2); }
+Expr Xor_class::fold_Expr(Folder &f) { return binary(f, this, FXor, e1, e2); }
+Expr Bitand_class::fold_Expr(Folder &f) { return binary(f, this, FBitand, e1, e2); }
+Expr Bitor_class::fold_Expr(Folder &f) { return binary(f, this, FBitor, e1, e2); }
+
+Expr Neg_class::fold_Expr(Folder &f) { return unary(f, this, FNeg, e1); }
+Expr Not_class::fold_Expr(Folder &f) { return unary(f, this, FNot, e1); }
+Expr Bitnot_class::fold_Expr(Folder &f) { return unary(f, this, FBitnot, e1); }
+Expr IntToFloat_class::fold_Expr(Folder &f) { return unary(f, this, FIntToFloat, e1); }
+
+Expr Const_int_class::fold_Expr(Folder &f) { return this; }
+Expr Const_string_class::fold_Expr(Folder &f) { return this; }
+Expr Const_float_class::fold_Expr(Folder &f) { return this; }
+Expr Const_bool_class::fold_Expr(Folder &f) { return this; }
+Expr Object_class::fold_Expr(Folder &f) { return this; }
+Expr No_expr_class::fold_Expr(Folder &f) { return this; }
+
+Expr Call_class::fold_Expr(Folder &f)
+{
+    std::vector<Actual> args;
+    actuals->collect(args);
+    for (Actual arg : args)
+        arg->fold_Expr(f);
+    return this;
+}
+
+Expr Actual_class::fold_Expr(Folder &f)
+{
+    expr = expr->fold_Expr(f);
+    return this;
+}
+
+Expr Assign_class::fold_Expr(Folder &f)
+{
+    value = value->fold_Expr(f);
+    return this;
+}
+
+//
+// Statements
+//
+
+void CallDecl_class::fold(Folder &f)
+{
+    body->fold_Stmt(f);
+}
+
+Stmt StmtBlock_class::fold_Stmt(Folder &f)
+{
+    std::vector<Stmt> list;
+    stmts->collect(list);
+    bool changed = false;
+    for (Stmt &s : list) {
+        Stmt folded = s->fold_Stmt(f);
+        changed |= folded != s;
+        s = folded;
+    }
+    if (changed) {
+        stmts = nil_Stmts();
+        for (Stmt s : list)
+            stmts = append_Stmts(stmts, single_Stmts(s));
+    }
+    return this;
+}
+
+Stmt IfStmt_class::fold_Stmt(Folder &f)
+{
+    condition = condition->fold_Expr(f);
+    thenexpr->fold_Stmt(f);
+    elseexpr->fold_Stmt(f);
+    return this;
+}
+
+Stmt WhileStmt_class::fold_Stmt(Folder &f)
+{
+    condition = condition->fold_Expr(f);
+    body->fold_Stmt(f);
+    return this;
+}
+
+Stmt ForStmt_class::fold_Stmt(Folder &f)
+{
+    initexpr = initexpr->fold_Expr(f);
+    condition = condition->fold_Expr(f);
+    loopact = loopact->fold_Expr(f);
+    body->fold_Stmt(f);
+    return this;
+}
+
+Stmt ReturnStmt_class::fold_Stmt(Folder &f)
+{
+    value = value->fold_Expr(f);
+    return this;
+}
+
+Stmt ContinueStmt_class::fold_Stmt(Folder &f) { return this; }
+Stmt BreakStmt_class::fold_Stmt(Folder &f) { return this; }
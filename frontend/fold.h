@@ -0,0 +1,56 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _FOLD_H_
+#define _FOLD_H_
+
+#include <map>
+#include <string>
+#include "seal-expr.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Constant folding
+//
+//  After a program has been checked, CallDecl_class::fold() (fold.cc)
+//  replaces every operator whose operands are constants by the constant
+//  it gives, and every operator that an algebraic identity makes a no-op
+//  (x * 1, x + 0, b && true, ...) by its other operand.  fold_Expr()
+//  returns the node that takes the place of an expression, fold_Stmt()
+//  that of a statement.
+//
+//  The values are those the program computes when it runs: Int is 64-bit
+//  and wraps around, Float is a double, and an Int meeting a Float is
+//  converted first.  What traps or gives no number at run time, such as
+//  an Int divided by zero or a Float that overflows, is not folded.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// The value of a Const_int, Const_float or Const_bool
+struct FoldValue {
+    enum Kind { Int, Float, Bool } kind;
+    long long i;        // an Int, or a Bool as 0 or 1
+    double f;           // a Float
+
+    double number() const { return kind == Float ? f : (double) i; }
+};
+
+class Folder {
+    std::map<long long, Symbol> ints;
+    std::map<std::string, Symbol> floats;
+public:
+    Symbol Int;         // the type Int
+    int folded;         // operators replaced by a constant
+    int simplified;     // operators replaced by an operand
+
+    Folder(Symbol int_type) : Int(int_type), folded(0), simplified(0) { }
+
+    // a constant standing where e stood, or NULL if v has no literal
+    Expr constant(Expr e, const FoldValue &v);
+};
+
+#endif
@@ -0,0 +1,229 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "seal-io.h"
+#include <unistd.h>
+#include "cgen_gc.h"
+#include "diagnostics.h"
+#include "dumpformat.h"
+
+//
+// sealc provides a debugging switch for each phase of the compiler,
+// switches to control garbage collection policy, and a switch to enable 
+// optimization.  The optimization flag is ignored by the reference compiler.
+//
+// All flags that can be set on the command line should be defined here;
+// otherwise, it is necessary to pollute test drivers for components of the
+// compiler with declarations of extern'ed debugging flags to satisfy the
+// linker.  The exceptions to this rule are yy_flex_debug, seal_yydebug
+// and semant_yydebug, which are defined in files generated by flex and
+// bison.
+//
+// -S, -R, -L and -I choose how parser parses; the other phases read
+// their input with one parser only, so they refuse them unless
+// parse_modes_accepted is set before handle_flags() is called.
+//
+
+extern int yy_flex_debug;       // for the lexer; prints recognized rules
+extern int seal_yydebug;        // for the parser
+extern int semant_yydebug;      // for the parser of semant's input
+       int parse_modes_accepted; // -S -R -L -I may be given
+       int lex_verbose;         // also for the lexer; prints tokens
+       int parse_stream;        // parser hands out declarations as they are reduced
+       int parse_rd;            // use the hand-written parser instead of bison's
+       int parse_outline;       // parse function bodies only when first used
+       int parse_incremental;   // reparse edited files reusing unchanged decls
+       int semant_debug;        // for semantic analysis
+       int jobs;                // threads for per-function work; 0: one per CPU
+       char *cache_dir;         // where to keep checked functions and outputs; NULL: nowhere
+       long long cache_limit;   // bytes the cache may take before the least recently used go
+       char *call_graph_file;   // where to write the call graph; NULL: nowhere
+       int remove_dead_decls;   // drop what main cannot reach
+       int check_dead_decls;    // ... but check it first
+       int dump_format;         // how the tree is dumped: DumpText, DumpJson, ...
+       int cgen_debug;          // for code gen
+       bool disable_reg_alloc;  // Don't do register allocation
+
+       int cgen_optimize;       // optimize switch for code generator 
+       char *out_filename;      // file name for generated code
+       Memmgr cgen_Memmgr = GC_NOGC;      // enable/disable garbage collection
+       Memmgr_Test cgen_Memmgr_Test = GC_NORMAL;  // normal/test GC
+       Memmgr_Debug cgen_Memmgr_Debug = GC_QUICK; // check heap frequently
+
+// used for option processing (man 3 getopt for more info)
+extern int optind, opterr;
+extern char *optarg;
+
+void handle_flags(int argc, char *argv[]) {
+  int c;
+  int unknownopt = 0;
+
+  // no debugging or optimization by default; every flag is set here, so
+  // that parsing a second command line (a compile server's request)
+  // keeps nothing from the first
+  yy_flex_debug = 0;
+  seal_yydebug = 0;
+  semant_yydebug = 0;
+  lex_verbose  = 0;
+  parse_stream = 0;
+  parse_rd = 0;
+  parse_outline = 0;
+  parse_incremental = 0;
+  semant_debug = 0;
+  jobs = 0;
+  cache_dir = NULL;
+  cache_limit = 1LL << 30;
+  call_graph_file = NULL;
+  remove_dead_decls = 0;
+  check_dead_decls = 0;
+  dump_format = DumpText;
+  cgen_debug = 0;
+  cgen_optimize = 0;
+  disable_reg_alloc = 0;
+  out_filename = NULL;
+  cgen_Memmgr = GC_NOGC;
+  cgen_Memmgr_Test = GC_NORMAL;
+  cgen_Memmgr_Debug = GC_QUICK;
+  diagnostics.max_errors = 0;
+  diagnostics.dedupe = false;
+  diagnostics.format = DiagText;
+  
+
+  while ((c = getopt(argc, argv, "lpscvrSRLIODKo:j:e:f:C:M:G:uJgtT")) != -1) {
+    if (strchr("SRLI", c) && !parse_modes_accepted) {
+      cerr << argv[0] << ": -" << (char) c << " is an option of parser only\n";
+      unknownopt = 1;
+      continue;
+    }
+    switch (c) {
+#ifdef DEBUG
+    case 'l':
+      yy_flex_debug = 1;
+      break;
+    case 'p':
+      seal_yydebug = 1;
+      semant_yydebug = 1;
+      break;
+    case 's':
+      semant_debug = 1;
+      break;
+    case 'c':
+      cgen_debug = 1;
+      break;
+    case 'v':
+      lex_verbose = 1;
+      break;
+    case 'r':
+      disable_reg_alloc = 1;
+      break;
+#else
+    case 'l':
+    case 'p':
+    case 's':
+    case 'c': 
+    case 'v':
+    case 'r':
+      cerr << "No debugging available\n";
+      break;
+#endif
+    case 'g':  // enable garbage collection
+      cgen_Memmgr = GC_GENGC;
+      break;
+    case 't':  // run garbage collection very frequently (on every allocation)
+      cgen_Memmgr_Test = GC_TEST;
+      break;
+    case 'T':  // do even more pedantic tests in garbage collection
+      cgen_Memmgr_Debug = GC_DEBUG;
+      break;
+    case 'o':  // set the name of the output file
+      out_filename = optarg;
+      break;
+    case 'j':  // number of threads
+      jobs = atoi(optarg);
+      break;
+    case 'e':  // stop after this many errors
+      diagnostics.max_errors = atoi(optarg);
+      break;
+    case 'f':  // dump the tree as text, json (JSON Lines) or binary
+      if (strcmp(optarg, "text") == 0)
+        dump_format = DumpText;
+      else if (strcmp(optarg, "json") == 0)
+        dump_format = DumpJson;
+      else if (strcmp(optarg, "binary") == 0)
+        dump_format = DumpBinary;
+      else
+        unknownopt = 1;
+      break;
+    case 'C':  // cache the results of semantic analysis in this directory
+      cache_dir = optarg;
+      break;
+    case 'M':  // bound the cache: bytes, or with a k, M or G after them
+      {
+        char *end;
+        cache_limit = strtoll(optarg, &end, 10);
+        switch (*end) {
+        case 'k': case 'K': cache_limit <<= 10; break;
+        case 'm': case 'M': cache_limit <<= 20; break;
+        case 'g': case 'G': cache_limit <<= 30; break;
+        case '\0': break;
+        default: unknownopt = 1;
+        }
+      }
+      break;
+    case 'G':  // write the call graph, as JSON if the name ends in .json
+      call_graph_file = optarg;
+      break;
+    case 'D':  // drop functions and globals main does not use
+      remove_dead_decls = 1;
+      break;
+    case 'K':  // with -D, still check what is dropped
+      check_dead_decls = 1;
+      break;
+    case 'u':  // report each distinct error once
+      diagnostics.dedupe = true;
+      break;
+    case 'J':  // errors as JSON
+      diagnostics.format = DiagJson;
+      break;
+    case 'O':  // enable optimization
+      cgen_optimize = 1;
+      break;
+    case 'S':  // streaming parse: emit each declaration once it is complete
+      parse_stream = 1;
+      break;
+    case 'R':  // parse with the recursive-descent parser (seal-rdparse.cc)
+      parse_rd = 1;
+      break;
+    case 'L':  // outline parse: skip function bodies until they are used
+      parse_outline = 1;
+      break;
+    case 'I':  // incremental: each input file is an edit of the previous one
+      parse_incremental = 1;
+      break;
+    case '?':
+      unknownopt = 1;
+      break;
+    case ':':
+      unknownopt = 1;
+      break;
+    }
+  }
+
+  if (unknownopt) {
+      const char *modes = parse_modes_accepted ? "SRLI" : "";
+      cerr << "usage: " << argv[0] << 
+#ifdef DEBUG
+	  " [-lvpsc" << modes << "ODKuJgtTr -o outname -j jobs -e max-errors -f text|json|binary -C cachedir -M cachesize -G callgraph] [input-files]\n";
+#else
+      " [-" << modes << "ODKuJgtT -o outname -j jobs -e max-errors -f text|json|binary -C cachedir -M cachesize -G callgraph] [input-files]\n";
+#endif
+      exit(1);
+  }
+
+}
@@ -0,0 +1,114 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _PARSE_CONTEXT_H_
+#define _PARSE_CONTEXT_H_
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "seal-decl.h"
+#include "seal-stmt.h"
+#include "diagnostics.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  ParseContext
+//
+//  Everything one run of a parser produces or updates.  Both parsers are
+//  pure: seal_yyparse() (seal.y) and semant_yyparse() (seal-semant.y, the
+//  type-first declarations semant reads) keep their stacks and lookahead
+//  on the C++ stack and report through the context they are given, and
+//  the scanner keeps its state per thread, so parses on separate threads
+//  with separate contexts share no result, error count or line number.
+//
+//      ast_root        the result of the parse
+//      omerrs          number of errors in lexing and parsing
+//      filename        file name used in syntax error messages
+//      decl_handler    if set, called with every top-level declaration as
+//                      soon as it is reduced (see seal_yyparse_stream)
+//      last_token      the most recent token read, for error messages
+//      diags           where syntax errors are reported; the phase's
+//                      diagnostics unless set otherwise
+//
+//////////////////////////////////////////////////////////////////////////////
+
+struct ParseContext {
+    Program ast_root;
+    int omerrs;
+    char *filename;
+    void (*decl_handler)(Decl);
+    int last_token;
+    DiagnosticEngine *diags;
+
+    ParseContext(char *fname) : ast_root(NULL), omerrs(0), filename(fname),
+                                decl_handler(NULL), last_token(0),
+                                diags(&diagnostics) { }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  LazyBody
+//
+//  A function body the outline parser skipped: the byte range of its
+//  stmtBlock, found by brace matching, in a copy of the source that lives
+//  as long as the tree, and where its declaration starts.
+//  CallDecl_class::getBody() parses it on first use; syntax errors found
+//  then are reported and counted in ctx, which must outlive the tree.  The
+//  scanner's state is per thread; a body forced while the same thread is in
+//  another parse leaves that parse's current token as it was.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+struct LazyBody {
+    ParseContext *ctx;
+    const char *text;   // the whole source
+    int len;            // its length
+    int begin, end;     // '{' .. one past the matching '}'
+    int line;           // line of '{'
+    int decl_begin;     // "func" of the declaration
+    int decl_line;      // its line
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  ReparseCache
+//
+//  What seal_reparse() keeps of the last parse of a file: its text and
+//  its declaration regions, each with the offset and line it starts at,
+//  a hash of its text and its tree.  reused and parsed count the
+//  declarations of the last call that were kept and that had to be
+//  parsed.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+struct ReparseCache {
+    struct Region {
+        int start;
+        int line;
+        unsigned long long hash;
+        Decl decl;
+    };
+    std::string text;
+    std::vector<Region> regions;
+    int reused, parsed;
+
+    ReparseCache() : reused(0), parsed(0) { }
+};
+
+int seal_yyparse(ParseContext *ctx);
+int seal_yyparse_stream(ParseContext *ctx);
+int seal_rdparse(ParseContext *ctx);        // seal-rdparse.cc
+int semant_yyparse(ParseContext *ctx);      // seal-semant.y
+char *read_source(FILE *f, int *len);
+int seal_outline_parse(ParseContext *ctx, FILE *f);
+StmtBlock parse_lazy_body(LazyBody *b);
+int seal_reparse(ParseContext *ctx, ReparseCache *cache, const char *source, int len);
+
+// reports a syntax error at line *llocp; defined in seal.y
+void seal_yyerror(int *llocp, ParseContext *ctx, const char *s);
+
+#endif
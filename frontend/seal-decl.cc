@@ -2,12 +2,13 @@
 #include "seal-decl.h"
 #include "seal-expr.h"
 #include "seal-stmt.h"
+#include "parse_context.h"
 
 
 
 Decl VariableDecl_class::copy_Decl()
 {
-   return new VariableDecl_class(variable->copy_Variable());
+   return new VariableDecl_class(line_number, variable->copy_Variable());
 }
 
 
@@ -20,21 +21,35 @@ void VariableDecl_class::dump(ostream& stream, int n)
 
 Variable Variable_class::copy_Variable()
 {
-   return new Variable_class(copy_Symbol(type), copy_Symbol(name));
+   return new Variable_class(line_number, copy_Symbol(name), copy_Symbol(type));
 }
 
 
 void Variable_class::dump(ostream& stream, int n)
 {
    stream << pad(n) << "_variable\n";
-   dump_Symbol(stream, n+2, type);
    dump_Symbol(stream, n+2, name);
+   dump_Symbol(stream, n+2, type);
 }
 
 
 Decl CallDecl_class::copy_Decl()
 {
-   return new CallDecl_class(copy_Symbol(name), paras->copy_list(), copy_Symbol(returnType), body->copy_StmtBlock());
+   if (body == NULL) {
+      // both copies may parse the shared source range on their own
+      CallDecl_class *c = new CallDecl_class(line_number, copy_Symbol(name), paras->copy_list(), copy_Symbol(returnType), NULL);
+      c->setLazyBody(lazy_body);
+      return c;
+   }
+   return new CallDecl_class(line_number, copy_Symbol(name), paras->copy_list(), copy_Symbol(returnType), body->copy_StmtBlock());
+}
+
+
+StmtBlock CallDecl_class::getBody()
+{
+   if (body == NULL)
+      body = parse_lazy_body(lazy_body);
+   return body;
 }
 
 
@@ -43,7 +58,7 @@ void CallDecl_class::dump(ostream& stream, int n)
    stream << pad(n) << "_callDecl\n";
    dump_Symbol(stream, n+2, name);
    paras->dump(stream, n+2);
-   body->dump(stream, n+2);
+   getBody()->dump(stream, n+2);
    dump_Symbol(stream, n+2, returnType);
 }
 
@@ -90,18 +105,18 @@ Variables append_Variables(Variables p1, Variables p2)
 }
 
 
-VariableDecl variableDecl(Variable v)
+VariableDecl variableDecl(int line, Variable v)
 {
-  return new VariableDecl_class(v);
+  return new VariableDecl_class(line, v);
 }
 
 
-Variable variable(Symbol a1, Symbol a2)
+Variable variable(int line, Symbol a1, Symbol a2)
 {
-  return new Variable_class(a1, a2);
+  return new Variable_class(line, a1, a2);
 }
 
-CallDecl callDecl(Symbol a1, Variables a2, Symbol a3, StmtBlock a4)
+CallDecl callDecl(int line, Symbol a1, Variables a2, Symbol a3, StmtBlock a4)
 {
-  return new CallDecl_class(a1, a2, a3, a4);
+  return new CallDecl_class(line, a1, a2, a3, a4);
 }
\ No newline at end of file
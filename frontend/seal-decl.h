@@ -5,14 +5,19 @@
 #include "tree.h"
 #include "seal-tree.handcode.h"
 
+struct LazyBody;    // parse_context.h
 
 
 class Decl_class : public tree_node {
 public:
+    Decl_class(int line) : tree_node(line) { }
     tree_node *copy()		 { return copy_Decl(); }
     virtual Decl copy_Decl() = 0;
     virtual void dump_with_types(ostream&,int) = 0; 
+    virtual void encode(TreeEncoder &) = 0;
     virtual void dump(ostream&,int) = 0;
+    // parse now a body the outline parser skipped (-L), if there is one
+    virtual void force_body() { }
     virtual bool isCallDecl() = 0;
     virtual Symbol getName() = 0;
     virtual Symbol getType() = 0;
@@ -23,12 +28,12 @@ public:
 
 class Variable_class : public tree_node {
 protected:
-   Symbol type;
    Symbol name;
+   Symbol type;
 public:
-   Variable_class(Symbol a1, Symbol a2) {
-      type = a1;
-      name = a2;
+   Variable_class(int line, Symbol a1, Symbol a2) : tree_node(line) {
+      name = a1;
+      type = a2;
    }
    tree_node *copy()		 { return copy_Variable(); }
    Symbol getName() { return name; }
@@ -37,13 +42,15 @@ public:
    Variable copy_Variable();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int);
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
 };
 
 class VariableDecl_class : public Decl_class {
 protected:
    Variable variable;
 public:
-   VariableDecl_class(Variable a1) {
+   VariableDecl_class(int line, Variable a1) : Decl_class(line) {
       variable = a1;
    }
    Symbol getName() { return variable->getName(); }
@@ -53,6 +60,9 @@ public:
    void check();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int);
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
    bool isCallDecl(){return false;}; 
 
    Variables getVariables() { return Variables_class::nil(); }  
@@ -64,24 +74,33 @@ protected:
     Variables paras;
     Symbol   returnType;
     StmtBlock body;
+    LazyBody *lazy_body;    // unparsed body, outline mode only
     
 public:
-   CallDecl_class(Symbol a1, Variables a2, Symbol a3, StmtBlock a4) {
+   CallDecl_class(int line, Symbol a1, Variables a2, Symbol a3, StmtBlock a4) : Decl_class(line) {
       name = a1;
       paras = a2;
       returnType = a3;
       body = a4;
+      lazy_body = NULL;
    }
    
    Symbol getName(){return name;}
    Symbol getType(){return returnType;}
    Variables getVariables(){return paras;}
-   StmtBlock getBody(){return body;}
+   // the body, parsed here on first use if the outline parser skipped it
+   StmtBlock getBody();
+   void force_body() { getBody(); }
+   void setLazyBody(LazyBody *b) { body = NULL; lazy_body = b; }
 
    Decl copy_Decl();
    void check();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int);
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   void fold(Folder &);
    bool isCallDecl(){return true;}
 };
 
@@ -109,8 +128,8 @@ Variables nil_Variables();
 Variables single_Variables(Variable);
 Variables append_Variables(Variables,Variables);
 
-VariableDecl variableDecl(Variable);
-Variable variable(Symbol,Symbol);
-CallDecl callDecl(Symbol, Variables, Symbol, StmtBlock);
+VariableDecl variableDecl(int, Variable);
+Variable variable(int, Symbol,Symbol);
+CallDecl callDecl(int, Symbol, Variables, Symbol, StmtBlock);
 
 #endif
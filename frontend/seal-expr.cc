@@ -6,7 +6,9 @@
 
 Expr Assign_class::copy_Expr()
 {
-   return new Assign_class(copy_Symbol(lvalue), value->copy_Expr());
+   Assign_class *a = new Assign_class(line_number, copy_Symbol(lvalue), value->copy_Expr());
+   a->setBinding(binding);
+   return a;
 }
 
 
@@ -19,7 +21,7 @@ void Assign_class::dump(ostream& stream, int n)
 
 Expr Add_class::copy_Expr()
 {
-   return new Add_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Add_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -32,7 +34,7 @@ void Add_class::dump(ostream& stream, int n)
 
 Expr Minus_class::copy_Expr()
 {
-   return new Minus_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Minus_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -45,7 +47,7 @@ void Minus_class::dump(ostream& stream, int n)
 
 Expr Multi_class::copy_Expr()
 {
-   return new Multi_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Multi_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -58,7 +60,7 @@ void Multi_class::dump(ostream& stream, int n)
 
 Expr Divide_class::copy_Expr()
 {
-   return new Divide_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Divide_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -71,7 +73,7 @@ void Divide_class::dump(ostream& stream, int n)
 
 Expr Mod_class::copy_Expr()
 {
-   return new Mod_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Mod_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -85,7 +87,7 @@ void Mod_class::dump(ostream& stream, int n)
 
 Expr Neg_class::copy_Expr()
 {
-   return new Neg_class(e1->copy_Expr());
+   return new Neg_class(line_number, e1->copy_Expr());
 }
 
 
@@ -97,7 +99,7 @@ void Neg_class::dump(ostream& stream, int n)
 
 Expr Lt_class::copy_Expr()
 {
-   return new Lt_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Lt_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -110,7 +112,7 @@ void Lt_class::dump(ostream& stream, int n)
 
 Expr Le_class::copy_Expr()
 {
-   return new Le_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Le_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -123,7 +125,7 @@ void Le_class::dump(ostream& stream, int n)
 
 Expr Equ_class::copy_Expr()
 {
-   return new Equ_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Equ_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -136,7 +138,7 @@ void Equ_class::dump(ostream& stream, int n)
 
 Expr Neq_class::copy_Expr()
 {
-   return new Neq_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Neq_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -149,7 +151,7 @@ void Neq_class::dump(ostream& stream, int n)
 
 Expr Ge_class::copy_Expr()
 {
-   return new Ge_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Ge_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -162,7 +164,7 @@ void Ge_class::dump(ostream& stream, int n)
 
 Expr Gt_class::copy_Expr()
 {
-   return new Gt_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Gt_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -175,7 +177,7 @@ void Gt_class::dump(ostream& stream, int n)
 
 Expr And_class::copy_Expr()
 {
-   return new And_class(e1->copy_Expr(), e2->copy_Expr());
+   return new And_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -189,7 +191,7 @@ void And_class::dump(ostream& stream, int n)
 
 Expr Or_class::copy_Expr()
 {
-   return new Or_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Or_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -203,7 +205,7 @@ void Or_class::dump(ostream& stream, int n)
 
 Expr Xor_class::copy_Expr()
 {
-   return new Xor_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Xor_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -217,7 +219,7 @@ void Xor_class::dump(ostream& stream, int n)
 
 Expr Not_class::copy_Expr()
 {
-   return new Not_class(e1->copy_Expr());
+   return new Not_class(line_number, e1->copy_Expr());
 }
 
 
@@ -230,7 +232,7 @@ void Not_class::dump(ostream& stream, int n)
 
 Expr Bitnot_class::copy_Expr()
 {
-   return new Bitnot_class(e1->copy_Expr());
+   return new Bitnot_class(line_number, e1->copy_Expr());
 }
 
 
@@ -242,7 +244,7 @@ void Bitnot_class::dump(ostream& stream, int n)
 
 Expr Bitand_class::copy_Expr()
 {
-   return new Bitand_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Bitand_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -254,7 +256,7 @@ void Bitand_class::dump(ostream& stream, int n)
 
 Expr Bitor_class::copy_Expr()
 {
-   return new Bitor_class(e1->copy_Expr(), e2->copy_Expr());
+   return new Bitor_class(line_number, e1->copy_Expr(), e2->copy_Expr());
 }
 
 
@@ -264,10 +266,24 @@ void Bitor_class::dump(ostream& stream, int n)
    e1->dump(stream, n+2);
 }
 
+Expr IntToFloat_class::copy_Expr()
+{
+   return new IntToFloat_class(line_number, e1->copy_Expr());
+}
+
+
+void IntToFloat_class::dump(ostream& stream, int n)
+{
+   stream << pad(n) << "_int_to_float\n";
+   e1->dump(stream, n+2);
+}
+
 
 Object Object_class::copy_Object()
 {
-   return new Object_class(copy_Symbol(var));
+   Object o = new Object_class(line_number, copy_Symbol(var));
+   o->setBinding(binding);
+   return o;
 }
 
 void Object_class::dump(ostream& stream, int n)
@@ -279,7 +295,7 @@ void Object_class::dump(ostream& stream, int n)
 
 Expr Call_class::copy_Expr()
 {
-   return new Call_class(copy_Symbol(name), actuals->copy_list());
+   return new Call_class(line_number, copy_Symbol(name), actuals->copy_list());
 }
 
 void Call_class::dump(ostream& stream, int n)
@@ -291,7 +307,7 @@ void Call_class::dump(ostream& stream, int n)
 
 Expr Actual_class::copy_Expr()
 {
-   return new Actual_class(expr->copy_Expr());
+   return new Actual_class(line_number, expr->copy_Expr());
 }
 
 void Actual_class::dump(ostream& stream, int n)
@@ -303,7 +319,7 @@ void Actual_class::dump(ostream& stream, int n)
 
 Expr Const_int_class::copy_Expr()
 {
-   return new Const_int_class(copy_Symbol(value));
+   return new Const_int_class(line_number, copy_Symbol(value));
 }
 
 void Const_int_class::dump(ostream& stream, int n)
@@ -314,7 +330,7 @@ void Const_int_class::dump(ostream& stream, int n)
 
 Expr Const_string_class::copy_Expr()
 {
-   return new Const_string_class(copy_Symbol(value));
+   return new Const_string_class(line_number, copy_Symbol(value));
 }
 
 void Const_string_class::dump(ostream& stream, int n)
@@ -326,7 +342,7 @@ void Const_string_class::dump(ostream& stream, int n)
 
 Expr Const_float_class::copy_Expr()
 {
-   return new Const_float_class(copy_Symbol(value));
+   return new Const_float_class(line_number, copy_Symbol(value));
 }
 
 void Const_float_class::dump(ostream& stream, int n)
@@ -338,7 +354,7 @@ void Const_float_class::dump(ostream& stream, int n)
 
 Expr Const_bool_class::copy_Expr()
 {
-   return new Const_bool_class(copy_Boolean(value));
+   return new Const_bool_class(line_number, copy_Boolean(value));
 }
 
 void Const_bool_class::dump(ostream& stream, int n)
@@ -349,7 +365,7 @@ void Const_bool_class::dump(ostream& stream, int n)
 
 Expr No_expr_class::copy_Expr()
 {
-   return new No_expr_class();
+   return new No_expr_class(line_number);
 }
 
 
@@ -392,141 +408,145 @@ Actuals append_Actuals(Actuals p1, Actuals p2)
 }
 
 
-Expr assign(Symbol a1, Expr a2)
+Expr assign(int line, Symbol a1, Expr a2)
 {
-  return new Assign_class(a1, a2);
+  return new Assign_class(line, a1, a2);
 }
 
-Expr add(Expr a1,  Expr a2)
+Expr add(int line, Expr a1,  Expr a2)
 {
-	return new Add_class(a1, a2);
+	return new Add_class(line, a1, a2);
 }
 
-Expr minus(Expr a1,  Expr a2)
+Expr minus(int line, Expr a1,  Expr a2)
 {
-	return new Minus_class(a1, a2);
+	return new Minus_class(line, a1, a2);
 }
 
-Expr divide(Expr a1, Expr a2)
+Expr divide(int line, Expr a1, Expr a2)
 {
-  return new Divide_class(a1, a2);
+  return new Divide_class(line, a1, a2);
 }
 
-Expr mod(Expr a1, Expr a2)
+Expr mod(int line, Expr a1, Expr a2)
 {
-  return new Mod_class(a1, a2);
+  return new Mod_class(line, a1, a2);
 }
 
-Expr multi(Expr a1, Expr a2)
+Expr multi(int line, Expr a1, Expr a2)
 {
-  return new Multi_class(a1, a2);
+  return new Multi_class(line, a1, a2);
 }
 
-Expr neg(Expr a1)
+Expr neg(int line, Expr a1)
 {
-  return new Neg_class(a1);
+  return new Neg_class(line, a1);
 }
 
-Expr lt(Expr a1, Expr a2)
+Expr lt(int line, Expr a1, Expr a2)
 {
-  return new Lt_class(a1, a2);
+  return new Lt_class(line, a1, a2);
 }
 
-Expr le(Expr a1, Expr a2)
+Expr le(int line, Expr a1, Expr a2)
 {
-  return new Le_class(a1, a2);
+  return new Le_class(line, a1, a2);
 }
 
-Expr equ(Expr a1, Expr a2)
+Expr equ(int line, Expr a1, Expr a2)
 {
-  return new Equ_class(a1, a2);
+  return new Equ_class(line, a1, a2);
 }
 
-Expr neq(Expr a1, Expr a2)
+Expr neq(int line, Expr a1, Expr a2)
 {
-  return new Neq_class(a1, a2);
+  return new Neq_class(line, a1, a2);
 }
 
-Expr ge(Expr a1, Expr a2)
+Expr ge(int line, Expr a1, Expr a2)
 {
-  return new Ge_class(a1, a2);
+  return new Ge_class(line, a1, a2);
 }
 
-Expr gt(Expr a1, Expr a2)
+Expr gt(int line, Expr a1, Expr a2)
 {
-  return new Gt_class(a1, a2);
+  return new Gt_class(line, a1, a2);
 }
 
-Expr and_(Expr a1, Expr a2)
+Expr and_(int line, Expr a1, Expr a2)
 {
-  return new And_class(a1, a2);
+  return new And_class(line, a1, a2);
 }
 
-Expr or_(Expr a1, Expr a2)
+Expr or_(int line, Expr a1, Expr a2)
 {
-  return new Or_class(a1, a2);
+  return new Or_class(line, a1, a2);
 }
 
-Expr xor_(Expr a1, Expr a2)
+Expr xor_(int line, Expr a1, Expr a2)
 {
-  return new Xor_class(a1, a2);
+  return new Xor_class(line, a1, a2);
 }
 
-Expr not_(Expr a1)
+Expr not_(int line, Expr a1)
 {
-  return new Not_class(a1);
+  return new Not_class(line, a1);
 }
 
-Expr bitand_(Expr a1, Expr a2)
+Expr bitand_(int line, Expr a1, Expr a2)
 {
-  return new Bitand_class(a1, a2);
+  return new Bitand_class(line, a1, a2);
 }
 
-Expr bitor_(Expr a1, Expr a2)
+Expr bitor_(int line, Expr a1, Expr a2)
 {
-  return new Bitor_class(a1, a2);
+  return new Bitor_class(line, a1, a2);
 }
 
-Expr bitnot(Expr a1)
+Expr bitnot(int line, Expr a1)
+{
+  return new Bitnot_class(line, a1);
+}
+Expr int_to_float(int line, Expr a1)
 {
-  return new Bitnot_class(a1);
+  return new IntToFloat_class(line, a1);
 }
-Expr object(Symbol a1)
+Expr object(int line, Symbol a1)
 {
-  return new Object_class(a1);
+  return new Object_class(line, a1);
 }
 
-Call call(Symbol a1, Actuals a2)
+Call call(int line, Symbol a1, Actuals a2)
 {
-  return new Call_class(a1, a2);
+  return new Call_class(line, a1, a2);
 }
 
-Actual actual(Expr a1)
+Actual actual(int line, Expr a1)
 {
-  return new Actual_class(a1);
+  return new Actual_class(line, a1);
 }
 
-Expr const_int(Symbol a1)
+Expr const_int(int line, Symbol a1)
 {
-	return new Const_int_class(a1);
+	return new Const_int_class(line, a1);
 }
 
-Expr const_bool(Boolean a1)
+Expr const_bool(int line, Boolean a1)
 {
-	return new Const_bool_class(a1);
+	return new Const_bool_class(line, a1);
 }
 
-Expr const_string(Symbol a1)
+Expr const_string(int line, Symbol a1)
 {
-	return new Const_string_class(a1);
+	return new Const_string_class(line, a1);
 }
 
-Expr const_float(Symbol a1)
+Expr const_float(int line, Symbol a1)
 {
-	return new Const_float_class(a1);
+	return new Const_float_class(line, a1);
 }
 
-Expr no_expr()
+Expr no_expr(int line)
 {
-	return new No_expr_class();
+	return new No_expr_class(line);
 }
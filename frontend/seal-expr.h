@@ -12,6 +12,16 @@ typedef class Actual_class *Actual;
 typedef class Object_class *Object;
 typedef class Call_class *Call;
 
+// The declaration a name in an Object or Assign is bound to, set once by
+// the semantic checker.  slot is the index of the variable among the
+// globals, among the parameters of its function, or among all the locals
+// of its function.
+struct Binding {
+   enum Kind { Global, Param, Local } kind;
+   int slot;
+   Symbol type;
+   Binding(Kind k, int n, Symbol t) : kind(k), slot(n), type(t) { }
+};
 
 class Expr_class : public Stmt_class {
 public:     
@@ -19,16 +29,20 @@ public:
    Symbol getType() { return type; }           
    Expr setType(Symbol s) { type = s; return this; } 
    Stmt copy_Stmt() { return copy_Expr(); }             
-   Expr_class() { type = (Symbol) NULL; }
-   Expr_class(Symbol a1) {
+   Stmt fold_Stmt(Folder &f) { return fold_Expr(f); }
+   Expr_class(int line) : Stmt_class(line) { type = (Symbol) NULL; }
+   Expr_class(int line, Symbol a1) : Stmt_class(line) {
         type = a1;
    }
    void check(Symbol a) {checkType();}
    void dump_type(ostream&, int);
 
    virtual void dump_with_types(ostream&,int) = 0; 
+   virtual void encode(TreeEncoder &) = 0;
 	virtual void dump(ostream&,int) = 0;
    virtual Expr copy_Expr() = 0;
+   virtual Expr fold_Expr(Folder &) = 0;
+   virtual bool constant(FoldValue &) { return false; }
    virtual Symbol checkType() = 0;
    virtual bool is_empty_Expr() = 0;
 };
@@ -38,7 +52,7 @@ protected:
    Symbol name;
    Actuals actuals;
 public:
-   Call_class(Symbol a1, Actuals a2)  {
+   Call_class(int line, Symbol a1, Actuals a2) : Expr_class(line)  {
         name = a1;
         actuals = a2;
    }
@@ -47,6 +61,10 @@ public:
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
 	void dump(ostream&,int);
    void dump_type(ostream& , int );
    Symbol checkType();
@@ -57,12 +75,16 @@ class Actual_class : public Expr_class {
 protected:
     Expr expr;
 public:
-   Actual_class(Expr a1)  {
+   Actual_class(int line, Expr a1) : Expr_class(line)  {
         expr = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
 	void dump(ostream&,int);
    void dump_type(ostream& , int );
    Symbol checkType();
@@ -73,15 +95,23 @@ class Assign_class : public Expr_class {
 protected:
    Symbol lvalue;
    Expr value;
+   Binding *binding;
 public:
-   Assign_class(Symbol a1, Expr a2)  {
+   Assign_class(int line, Symbol a1, Expr a2) : Expr_class(line)  {
       lvalue = a1;
       value = a2;
+      binding = NULL;
    }
+   Binding *getBinding() { return binding; }
+   void setBinding(Binding *b) { binding = b; }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -91,7 +121,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Add_class(Expr a1, Expr a2) {
+   Add_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -99,6 +129,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -108,7 +142,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Minus_class(Expr a1, Expr a2) {
+   Minus_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -116,6 +150,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -125,7 +163,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Multi_class(Expr a1, Expr a2) {
+   Multi_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -133,6 +171,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int);
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType(); 
 };
 
@@ -142,7 +184,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Divide_class(Expr a1, Expr a2) {
+   Divide_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -150,6 +192,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -159,7 +205,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Mod_class(Expr a1, Expr a2) {
+   Mod_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -167,6 +213,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -175,13 +225,17 @@ class Neg_class : public Expr_class {
 protected:
    Expr e1;
 public:
-   Neg_class(Expr a1) {
+   Neg_class(int line, Expr a1) : Expr_class(line) {
       e1 = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -191,7 +245,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Lt_class(Expr a1, Expr a2) {
+   Lt_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -199,6 +253,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -208,7 +266,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Le_class(Expr a1, Expr a2) {
+   Le_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -216,6 +274,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -225,7 +287,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Equ_class(Expr a1, Expr a2) {
+   Equ_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -233,6 +295,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -242,7 +308,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Neq_class(Expr a1, Expr a2) {
+   Neq_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -250,6 +316,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -259,7 +329,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Ge_class(Expr a1, Expr a2) {
+   Ge_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -267,6 +337,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -276,7 +350,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Gt_class(Expr a1, Expr a2) {
+   Gt_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -284,6 +358,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -293,7 +371,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   And_class(Expr a1, Expr a2) {
+   And_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -301,6 +379,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -310,7 +392,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Or_class(Expr a1, Expr a2) {
+   Or_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -318,6 +400,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -327,7 +413,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Xor_class(Expr a1, Expr a2) {
+   Xor_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -335,6 +421,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -343,13 +433,17 @@ class Not_class : public Expr_class {
 protected:
    Expr e1;
 public:
-   Not_class(Expr a1) {
+   Not_class(int line, Expr a1) : Expr_class(line) {
       e1 = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -358,13 +452,17 @@ class Bitnot_class : public Expr_class {
 protected:
    Expr e1;
 public:
-   Bitnot_class(Expr a1) {
+   Bitnot_class(int line, Expr a1) : Expr_class(line) {
       e1 = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -373,7 +471,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Bitand_class(Expr a1, Expr a2) {
+   Bitand_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -381,6 +479,10 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -389,7 +491,7 @@ protected:
    Expr e1;
    Expr e2;
 public:
-   Bitor_class(Expr a1, Expr a2) {
+   Bitor_class(int line, Expr a1, Expr a2) : Expr_class(line) {
       e1 = a1;
       e2 = a2;
    }
@@ -397,6 +499,30 @@ public:
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void shift_lines(int delta);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
+   Symbol checkType();
+};
+
+// an Int operand of an operator that also takes a Float, converted to
+// Float; inserted by the semantic checker, never parsed
+class IntToFloat_class : public Expr_class {
+protected:
+   Expr e1;
+public:
+   IntToFloat_class(int line, Expr a1) : Expr_class(line) {
+      e1 = a1;
+   }
+   Expr getExpr() { return e1; }
+   bool is_empty_Expr(){ return false;}
+   Expr copy_Expr();
+   void dump(ostream& stream, int n);
+   void dump_with_types(ostream&,int);
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -405,13 +531,17 @@ class Const_int_class : public Expr_class {
 protected:
    Symbol value;
 public:
-   Const_int_class(Symbol a1) {
+   Const_int_class(int line, Symbol a1) : Expr_class(line) {
       value = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
+   bool constant(FoldValue &);
    Symbol checkType();
 };
 
@@ -420,13 +550,16 @@ class Const_string_class : public Expr_class {
 protected:
    Symbol value;
 public:
-   Const_string_class(Symbol a1) {
+   Const_string_class(int line, Symbol a1) : Expr_class(line) {
       value = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -435,13 +568,17 @@ class Const_float_class : public Expr_class {
 protected:
    Symbol value;
 public:
-   Const_float_class(Symbol a1) {
+   Const_float_class(int line, Symbol a1) : Expr_class(line) {
       value = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
+   bool constant(FoldValue &);
    Symbol checkType();
 };
 
@@ -450,28 +587,39 @@ class Const_bool_class : public Expr_class {
 protected:
    Boolean value;
 public:
-   Const_bool_class(Boolean a1) {
+   Const_bool_class(int line, Boolean a1) : Expr_class(line) {
       value = a1;
    }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
+   bool constant(FoldValue &);
    Symbol checkType();
 };
 
 class Object_class : public Expr_class {
 protected:
    Symbol var;
+   Binding *binding;
 public:
-   Object_class(Symbol a1) {
+   Object_class(int line, Symbol a1) : Expr_class(line) {
       var = a1;
+      binding = NULL;
    }
+   Binding *getBinding() { return binding; }
+   void setBinding(Binding *b) { binding = b; }
    bool is_empty_Expr(){ return false;}
    Expr copy_Expr(){return copy_Object();};
    Object copy_Object();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -479,12 +627,15 @@ public:
 class No_expr_class : public Expr_class {
 protected:
 public:
-   No_expr_class() {
+   No_expr_class(int line) : Expr_class(line) {
    }
    bool is_empty_Expr(){ return true;}
    Expr copy_Expr();
    void dump(ostream& stream, int n);
    void dump_with_types(ostream&,int); 
+   void encode(TreeEncoder &);
+   void fingerprint(Fingerprint &);
+   Expr fold_Expr(Folder &);
    Symbol checkType();
 };
 
@@ -521,34 +672,35 @@ Constants single_Constants(Constant);
 Constants append_Constants(Constants,Constants);
 
 
-Expr assign(Symbol, Expr);
-Expr add( Expr,  Expr);
-Expr minus( Expr, Expr);
-Expr divide(Expr, Expr);
-Expr mod(Expr, Expr);
-Expr multi(Expr, Expr);
-Expr neg(Expr);
-Expr lt(Expr, Expr);
-Expr le(Expr, Expr);
-Expr equ(Expr, Expr);
-Expr neq(Expr, Expr);
-Expr ge(Expr, Expr);
-Expr gt(Expr, Expr);
-Expr and_(Expr, Expr);  // Bool && Bool
-Expr or_(Expr, Expr);   // Bool || Bool
-Expr xor_(Expr, Expr);  // Bool ^ Bool, Int ^ Int
-Expr not_(Expr);        // !Bool
-Expr bitand_(Expr, Expr);  // Int & int
-Expr bitor_(Expr, Expr);   // Int | Int
-Expr bitnot(Expr);         // ~Int
-Expr object(Symbol);
-Call call(Symbol, Actuals);
+Expr assign(int, Symbol, Expr);
+Expr add(int,  Expr,  Expr);
+Expr minus(int,  Expr, Expr);
+Expr divide(int, Expr, Expr);
+Expr mod(int, Expr, Expr);
+Expr multi(int, Expr, Expr);
+Expr neg(int, Expr);
+Expr lt(int, Expr, Expr);
+Expr le(int, Expr, Expr);
+Expr equ(int, Expr, Expr);
+Expr neq(int, Expr, Expr);
+Expr ge(int, Expr, Expr);
+Expr gt(int, Expr, Expr);
+Expr and_(int, Expr, Expr);  // Bool && Bool
+Expr or_(int, Expr, Expr);   // Bool || Bool
+Expr xor_(int, Expr, Expr);  // Bool ^ Bool, Int ^ Int
+Expr not_(int, Expr);        // !Bool
+Expr bitand_(int, Expr, Expr);  // Int & int
+Expr bitor_(int, Expr, Expr);   // Int | Int
+Expr bitnot(int, Expr);         // ~Int
+Expr int_to_float(int, Expr);   // Int as Float
+Expr object(int, Symbol);
+Call call(int, Symbol, Actuals);
 Actuals actuals(Exprs);
-Actual actual(Expr);
-Expr const_int(Symbol);
-Expr const_bool(Boolean);
-Expr const_string(Symbol);
-Expr const_float(Symbol);
-Expr no_expr();
+Actual actual(int, Expr);
+Expr const_int(int, Symbol);
+Expr const_bool(int, Boolean);
+Expr const_string(int, Symbol);
+Expr const_float(int, Symbol);
+Expr no_expr(int);
 
 #endif
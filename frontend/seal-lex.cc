@@ -203,12 +203,12 @@ typedef size_t yy_size_t;
 #endif
 
 /* %if-not-reentrant */
-extern yy_size_t yyleng;
+extern thread_local yy_size_t yyleng;
 /* %endif */
 
 /* %if-c-only */
 /* %if-not-reentrant */
-extern FILE *yyin, *yyout;
+extern thread_local FILE *yyin, *yyout;
 /* %endif */
 /* %endif */
 
@@ -310,9 +310,9 @@ struct yy_buffer_state
 /* %if-not-reentrant */
 
 /* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
+static thread_local size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
+static thread_local size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
+static thread_local YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
 /* %endif */
 /* %ok-for-header */
 
@@ -339,19 +339,19 @@ static YY_BUFFER_STATE * yy_buffer_stack = 0; /**< Stack as an array. */
 /* %not-for-header */
 
 /* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static yy_size_t yy_n_chars;		/* number of characters read into yy_ch_buf */
-yy_size_t yyleng;
+static thread_local char yy_hold_char;
+static thread_local yy_size_t yy_n_chars;		/* number of characters read into yy_ch_buf */
+thread_local yy_size_t yyleng;
 
 /* Points to current character in buffer. */
-static char *yy_c_buf_p = (char *) 0;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
+static thread_local char *yy_c_buf_p = (char *) 0;
+static thread_local int yy_init = 0;		/* whether we need to initialize */
+static thread_local int yy_start = 0;	/* start state number */
 
 /* Flag which is used to allow yywrap()'s to do buffer switches
  * instead of setting up a fresh yyin.  A bit of a hack ...
  */
-static int yy_did_buffer_switch_on_eof;
+static thread_local int yy_did_buffer_switch_on_eof;
 /* %ok-for-header */
 
 /* %endif */
@@ -414,15 +414,15 @@ void yyfree (void *  );
 
 typedef unsigned char YY_CHAR;
 
-FILE *yyin = (FILE *) 0, *yyout = (FILE *) 0;
+thread_local FILE *yyin = (FILE *) 0, *yyout = (FILE *) 0;
 
 typedef int yy_state_type;
 
-extern int yylineno;
+extern thread_local int yylineno;
 
-int yylineno = 1;
+thread_local int yylineno = 1;
 
-extern char *yytext;
+extern thread_local char *yytext;
 #define yytext_ptr yytext
 
 /* %if-c-only Standard (non-C++) definition */
@@ -628,8 +628,8 @@ static yyconst flex_int16_t yy_chk[277] =
       145,  145,  145,  145,  145,  145
     } ;
 
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
+static thread_local yy_state_type yy_last_accepting_state;
+static thread_local char *yy_last_accepting_cpos;
 
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
@@ -652,7 +652,7 @@ static yyconst flex_int16_t yy_rule_linenum[68] =
 #define yymore() yymore_used_but_not_detected
 #define YY_MORE_ADJ 0
 #define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
+thread_local char *yytext;
 #line 1 "seal.flex"
 /*
 *  The scanner definition for seal.
@@ -678,32 +678,40 @@ char *yytext;
 #define MAX_STR_CONST 256
 #define YY_NO_UNPUT   /* keep g++ happy */
 
-extern FILE *fin; /* we read from this file */
+/* All the state of the scanner, flex's own included, is thread_local, so
+ * that each thread scans an input of its own. */
+extern thread_local FILE *fin; /* we read from this file */
 
 /* define YY_INPUT so we read from the FILE fin:
  * This change makes it possible to use this scanner in
- * the seal compiler.
+ * the seal compiler.  read() hands over whatever is already available
+ * instead of blocking for a full buffer, so input arriving on a pipe is
+ * scanned as it comes in.
  */
 #undef YY_INPUT
 #define YY_INPUT(buf,result,max_size) \
-	if ( (result = fread( (char*)buf, sizeof(char), max_size, fin)) < 0) \
-		YY_FATAL_ERROR( "read() in flex scanner failed");
+	{ \
+	ssize_t n = read( fileno(fin), (char*)buf, max_size ); \
+	if ( n < 0 ) \
+		YY_FATAL_ERROR( "read() in flex scanner failed"); \
+	result = n; \
+	}
 
-char string_buf[MAX_STR_CONST]; /* to assemble string constants */
-char *string_buf_ptr;
+thread_local char string_buf[MAX_STR_CONST]; /* to assemble string constants */
+thread_local char *string_buf_ptr;
 
-extern int curr_lineno;
+extern thread_local int curr_lineno;
 extern int verbose_flag;
 
-extern YYSTYPE seal_yylval;
+extern thread_local YYSTYPE seal_yylval;
 
 /*
  *  Add Your own definitions here
  */
 
-char string_const[MAX_STR_CONST + 10];
-int string_const_len;
-bool str_contain_null_char;
+thread_local char string_const[MAX_STR_CONST + 10];
+thread_local int string_const_len;
+thread_local bool str_contain_null_char;
 
 /*
 * Define names for regular expressions here.
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,23 +45,20 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.5.1"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 2
 
 /* Push parsers.  */
-#define YYPUSH 0
+#define YYPUSH 1
 
 /* Pull parsers.  */
 #define YYPULL 1
@@ -65,13 +66,16 @@
 
 /* Substitute the variable and function names.  */
 #define yyparse         seal_yyparse
+#define yypush_parse    seal_yypush_parse
+#define yypull_parse    seal_yypull_parse
+#define yypstate_new    seal_yypstate_new
+#define yypstate_clear  seal_yypstate_clear
+#define yypstate_delete seal_yypstate_delete
+#define yypstate        seal_yypstate
 #define yylex           seal_yylex
 #define yyerror         seal_yyerror
 #define yydebug         seal_yydebug
 #define yynerrs         seal_yynerrs
-#define yylval          seal_yylval
-#define yychar          seal_yychar
-#define yylloc          seal_yylloc
 
 /* First part of user prologue.  */
 #line 6 "seal.y"
@@ -82,82 +86,32 @@
   #include "seal-expr.h"
   #include "stringtab.h"
   #include "utilities.h"
+  #include "parse_context.h"
 
-  extern char *curr_filename;
   /* Locations */
   #define YYLTYPE int              /* the type of locations */
-  #define seal_yylloc curr_lineno  /* use the curr_lineno from the lexer
-  for the location of tokens */
     
-    extern int node_lineno;          /* set before constructing a tree node
-    to whatever you want the line number
-    for the tree node to be */
-      
-      
       #define YYLLOC_DEFAULT(Current, Rhs, N)         \
-      Current = Rhs[1];                             \
-      node_lineno = Current;
-    
-    
-    #define SET_NODELOC(Current)  \
-    node_lineno = Current;
+      Current = Rhs[1];
     
     /* IMPORTANT NOTE ON LINE NUMBERS
     *********************************
-    * The above definitions and macros cause every terminal in your grammar to 
-    * have the line number supplied by the lexer. The only task you have to
-    * implement for line numbers to work correctly, is to use SET_NODELOC()
-    * before constructing any constructs from non-terminals in your grammar.
-    * Example: Consider you are matching on the following very restrictive 
-    * (fictional) construct that matches a plus between two integer constants. 
-    * (SUCH A RULE SHOULD NOT BE PART OF YOUR PARSER):
-    
-    add_consts	: INT_CONST '+' INT_CONST 
-    
-    * where INT_CONST is a terminal for an integer constant. Now, a correct
-    * action for this rule that attaches the correct line number to plus_const
-    * would look like the following:
+    * The above definitions cause every terminal in the grammar to have the
+    * line number supplied by the lexer, and every non-terminal to have the
+    * line number of its first symbol.  Every AST constructor takes the line
+    * number of the node as its first argument, so an action passes @$ (or
+    * any @i it prefers) explicitly:
     
     add_consts	: INT_CONST '+' INT_CONST 
     {
-      // Set the line number of the current non-terminal:
-      // ***********************************************
-      // You can access the line numbers of the i'th item with @i, just
-      // like you acess the value of the i'th exporession with $i.
-      //
-      // Here, we choose the line number of the last INT_CONST (@3) as the
-      // line number of the resulting expression (@$). You are free to pick
-      // any reasonable line as the line number of non-terminals. If you 
-      // omit the statement @$=..., bison has default rules for deciding which 
-      // line number to use. Check the manual for details if you are interested.
-      @$ = @3;
-      
-      
-      // Observe that we call SET_NODELOC(@3); this will set the global variable
-      // node_lineno to @3. Since the constructor call "plus" uses the value of 
-      // this global, the plus node will now have the correct line number.
-      SET_NODELOC(@3);
-      
-      // construct the result node:
-      $$ = add(int_const($1), int_const($3));
+      $$ = add(@$, const_int(@1, $1), const_int(@3, $3));
     }
     
+    * No global is involved, which keeps the parser reentrant.
     */
     
-    
-    
-    void yyerror(char *s);        /*  defined below; called for each parse error */
-    extern int yylex();           /*  the entry point to the lexer  */
-    
-    /************************************************************************/
-    /*                DONT CHANGE ANYTHING IN THIS SECTION                  */
-    
-    Program ast_root;	      /* the result of the parse  */
-    //Decls parse_results;        /* for use in semantic analysis */
-    int omerrs = 0;               /* number of errors in lexing and parsing */
-    
 
-#line 161 "seal.tab.c"
+#line 115 "seal.tab.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -180,169 +134,121 @@
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_SEAL_YY_SEAL_TAB_H_INCLUDED
-# define YY_SEAL_YY_SEAL_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-#if YYDEBUG
-extern int seal_yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    IF = 258,
-    ELSE = 260,
-    WHILE = 261,
-    FOR = 262,
-    BREAK = 263,
-    CONTINUE = 264,
-    FUNC = 265,
-    RETURN = 266,
-    VAR = 271,
-    ERROR = 273,
-    AND = 274,
-    OR = 275,
-    EQUAL = 276,
-    NE = 277,
-    GE = 278,
-    LE = 279,
-    INT = 280,
-    STRING = 281,
-    BOOL = 282,
-    FLOAT = 283,
-    CONST_BOOL = 267,
-    CONST_INT = 268,
-    CONST_STRING = 269,
-    CONST_FLOAT = 270,
-    OBJECTID = 284,
-    TYPEID = 285,
-    UMINUS = 287,
-    neg_expr = 288,
-    bracket_expr = 289,
-    call_expr = 290,
-    object_expr = 291,
-    const_int_expr = 292,
-    const_float_expr = 293,
-    const_string_expr = 294,
-    const_bool_expr = 295
-  };
-#endif
-/* Tokens.  */
-#define IF 258
-#define ELSE 260
-#define WHILE 261
-#define FOR 262
-#define BREAK 263
-#define CONTINUE 264
-#define FUNC 265
-#define RETURN 266
-#define VAR 271
-#define ERROR 273
-#define AND 274
-#define OR 275
-#define EQUAL 276
-#define NE 277
-#define GE 278
-#define LE 279
-#define INT 280
-#define STRING 281
-#define BOOL 282
-#define FLOAT 283
-#define CONST_BOOL 267
-#define CONST_INT 268
-#define CONST_STRING 269
-#define CONST_FLOAT 270
-#define OBJECTID 284
-#define TYPEID 285
-#define UMINUS 287
-#define neg_expr 288
-#define bracket_expr 289
-#define call_expr 290
-#define object_expr 291
-#define const_int_expr 292
-#define const_float_expr 293
-#define const_string_expr 294
-#define const_bool_expr 295
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-union YYSTYPE
+#include "seal.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 89 "seal.y"
-
-      Boolean boolean;
-      Symbol symbol;
-      Program program;
-      Decl decl;
-      Decls decls;
-      VariableDecl variableDecl;
-      VariableDecls variableDecls;
-      Variable variable;
-      Variables variables;
-      CallDecl callDecl;
-      StmtBlock stmtBlock;
-      Stmt stmt;
-      Stmts stmts;
-      IfStmt ifStmt;
-      WhileStmt whileStmt;
-      ForStmt forStmt;
-      ReturnStmt returnStmt;
-      ContinueStmt continueStmt;
-      BreakStmt breakStmt;
-      Expr expr;
-      Exprs exprs;
-      Call call;
-      Actual actual;
-      Actuals actuals;
-      
-      char *error_msg;
-    
-
-#line 317 "seal.tab.c"
-
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IF = 3,                         /* IF  */
+  YYSYMBOL_ELSE = 4,                       /* ELSE  */
+  YYSYMBOL_WHILE = 5,                      /* WHILE  */
+  YYSYMBOL_FOR = 6,                        /* FOR  */
+  YYSYMBOL_BREAK = 7,                      /* BREAK  */
+  YYSYMBOL_CONTINUE = 8,                   /* CONTINUE  */
+  YYSYMBOL_FUNC = 9,                       /* FUNC  */
+  YYSYMBOL_RETURN = 10,                    /* RETURN  */
+  YYSYMBOL_VAR = 11,                       /* VAR  */
+  YYSYMBOL_ERROR = 12,                     /* ERROR  */
+  YYSYMBOL_AND = 13,                       /* AND  */
+  YYSYMBOL_OR = 14,                        /* OR  */
+  YYSYMBOL_EQUAL = 15,                     /* EQUAL  */
+  YYSYMBOL_NE = 16,                        /* NE  */
+  YYSYMBOL_GE = 17,                        /* GE  */
+  YYSYMBOL_LE = 18,                        /* LE  */
+  YYSYMBOL_INT = 19,                       /* INT  */
+  YYSYMBOL_STRING = 20,                    /* STRING  */
+  YYSYMBOL_BOOL = 21,                      /* BOOL  */
+  YYSYMBOL_FLOAT = 22,                     /* FLOAT  */
+  YYSYMBOL_CONST_BOOL = 23,                /* CONST_BOOL  */
+  YYSYMBOL_CONST_INT = 24,                 /* CONST_INT  */
+  YYSYMBOL_CONST_STRING = 25,              /* CONST_STRING  */
+  YYSYMBOL_CONST_FLOAT = 26,               /* CONST_FLOAT  */
+  YYSYMBOL_OBJECTID = 27,                  /* OBJECTID  */
+  YYSYMBOL_TYPEID = 28,                    /* TYPEID  */
+  YYSYMBOL_UMINUS = 29,                    /* UMINUS  */
+  YYSYMBOL_30_ = 30,                       /* '='  */
+  YYSYMBOL_31_ = 31,                       /* '>'  */
+  YYSYMBOL_32_ = 32,                       /* '<'  */
+  YYSYMBOL_33_ = 33,                       /* '+'  */
+  YYSYMBOL_34_ = 34,                       /* '-'  */
+  YYSYMBOL_35_ = 35,                       /* '*'  */
+  YYSYMBOL_36_ = 36,                       /* '/'  */
+  YYSYMBOL_37_ = 37,                       /* '%'  */
+  YYSYMBOL_38_ = 38,                       /* '!'  */
+  YYSYMBOL_39_ = 39,                       /* '~'  */
+  YYSYMBOL_40_ = 40,                       /* '&'  */
+  YYSYMBOL_41_ = 41,                       /* '|'  */
+  YYSYMBOL_42_ = 42,                       /* '^'  */
+  YYSYMBOL_neg_expr = 43,                  /* neg_expr  */
+  YYSYMBOL_bracket_expr = 44,              /* bracket_expr  */
+  YYSYMBOL_call_expr = 45,                 /* call_expr  */
+  YYSYMBOL_object_expr = 46,               /* object_expr  */
+  YYSYMBOL_const_int_expr = 47,            /* const_int_expr  */
+  YYSYMBOL_const_float_expr = 48,          /* const_float_expr  */
+  YYSYMBOL_const_string_expr = 49,         /* const_string_expr  */
+  YYSYMBOL_const_bool_expr = 50,           /* const_bool_expr  */
+  YYSYMBOL_51_ = 51,                       /* ';'  */
+  YYSYMBOL_52_ = 52,                       /* ','  */
+  YYSYMBOL_53_ = 53,                       /* '('  */
+  YYSYMBOL_54_ = 54,                       /* ')'  */
+  YYSYMBOL_55_ = 55,                       /* '{'  */
+  YYSYMBOL_56_ = 56,                       /* '}'  */
+  YYSYMBOL_YYACCEPT = 57,                  /* $accept  */
+  YYSYMBOL_program = 58,                   /* program  */
+  YYSYMBOL_decl = 59,                      /* decl  */
+  YYSYMBOL_decl_list = 60,                 /* decl_list  */
+  YYSYMBOL_variableDecl = 61,              /* variableDecl  */
+  YYSYMBOL_variableDecl_list = 62,         /* variableDecl_list  */
+  YYSYMBOL_variable = 63,                  /* variable  */
+  YYSYMBOL_variable_list = 64,             /* variable_list  */
+  YYSYMBOL_callDecl = 65,                  /* callDecl  */
+  YYSYMBOL_stmtBlock = 66,                 /* stmtBlock  */
+  YYSYMBOL_stmt = 67,                      /* stmt  */
+  YYSYMBOL_stmt_list = 68,                 /* stmt_list  */
+  YYSYMBOL_ifStmt = 69,                    /* ifStmt  */
+  YYSYMBOL_whileStmt = 70,                 /* whileStmt  */
+  YYSYMBOL_forStmt = 71,                   /* forStmt  */
+  YYSYMBOL_returnStmt = 72,                /* returnStmt  */
+  YYSYMBOL_continueStmt = 73,              /* continueStmt  */
+  YYSYMBOL_breakStmt = 74,                 /* breakStmt  */
+  YYSYMBOL_expr = 75,                      /* expr  */
+  YYSYMBOL_call = 76,                      /* call  */
+  YYSYMBOL_actual = 77,                    /* actual  */
+  YYSYMBOL_actual_list = 78                /* actual_list  */
 };
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
-/* Location type.  */
-#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE YYLTYPE;
-struct YYLTYPE
-{
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-};
-# define YYLTYPE_IS_DECLARED 1
-# define YYLTYPE_IS_TRIVIAL 1
-#endif
 
+/* Unqualified %code blocks.  */
+#line 47 "seal.y"
 
-extern YYSTYPE seal_yylval;
-extern YYLTYPE seal_yylloc;
-int seal_yyparse (void);
+      /*
+       * The scanner leaves the value of each token in seal_yylval and its
+       * line in curr_lineno, both private to the thread scanning.  They
+       * are defined here, and this adapter hands them to the pure parser.
+       */
+      thread_local YYSTYPE seal_yylval;
+      thread_local int curr_lineno = 1;
+      int seal_yylex();
 
-#endif /* !YY_SEAL_YY_SEAL_TAB_H_INCLUDED  */
+      static int seal_yylex(YYSTYPE *lvalp, YYLTYPE *llocp, ParseContext *ctx)
+      {
+        int token = seal_yylex();
+        *lvalp = seal_yylval;
+        *llocp = curr_lineno;
+        ctx->last_token = token;
+        return token;
+      }
 
+      /* defined below; called for each parse error */
+      void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s);
+    
 
+#line 252 "seal.tab.c"
 
 #ifdef short
 # undef short
@@ -381,6 +287,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -440,6 +358,7 @@ typedef int yytype_uint16;
 
 #define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
+
 /* Stored state numbers (used for stacks). */
 typedef yytype_uint8 yy_state_t;
 
@@ -458,6 +377,7 @@ typedef int yy_state_fast_t;
 # endif
 #endif
 
+
 #ifndef YY_ATTRIBUTE_PURE
 # if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
 #  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
@@ -476,17 +396,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -515,34 +441,10 @@ typedef int yy_state_fast_t;
 
 #define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
-
 # ifdef YYSTACK_ALLOC
    /* Pacify GCC's 'empty if-body' warning.  */
 #  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
@@ -580,8 +482,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -660,14 +561,16 @@ union yyalloc
 /* YYNSTATES -- Number of states.  */
 #define YYNSTATES  139
 
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   295
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
@@ -706,53 +609,53 @@ static const yytype_int8 yytranslate[] =
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   191,   191,   198,   201,   207,   210,   216,   222,   225,
-     231,   237,   240,   243,   249,   255,   258,   261,   264,   270,
-     273,   276,   279,   282,   285,   288,   291,   294,   300,   303,
-     309,   312,   318,   324,   327,   330,   333,   336,   339,   342,
-     345,   351,   354,   360,   366,   372,   375,   378,   381,   384,
-     387,   390,   393,   396,   399,   402,   405,   408,   411,   414,
-     417,   420,   423,   426,   429,   432,   435,   438,   441,   444,
-     447,   450,   456,   466,   472,   475,   478
+       0,   174,   174,   181,   184,   190,   194,   201,   207,   210,
+     216,   222,   225,   228,   234,   240,   243,   246,   249,   255,
+     258,   261,   264,   267,   270,   273,   276,   279,   285,   288,
+     294,   297,   303,   309,   312,   315,   318,   321,   324,   327,
+     330,   336,   339,   345,   351,   357,   360,   363,   366,   369,
+     372,   375,   378,   381,   384,   387,   390,   393,   396,   399,
+     402,   405,   408,   411,   414,   417,   420,   423,   426,   429,
+     432,   435,   441,   451,   457,   460,   463
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "IF", "ELSE", "WHILE", "FOR", "BREAK",
-  "CONTINUE", "FUNC", "RETURN", "VAR", "ERROR", "AND", "OR", "EQUAL", "NE",
-  "GE", "LE", "INT", "STRING", "BOOL", "FLOAT", "CONST_BOOL", "CONST_INT",
-  "CONST_STRING", "CONST_FLOAT", "OBJECTID", "TYPEID", "UMINUS", "'='",
-  "'>'", "'<'", "'+'", "'-'", "'*'", "'/'", "'%'", "'!'", "'~'", "'&'",
-  "'|'", "'^'", "neg_expr", "bracket_expr", "call_expr", "object_expr",
-  "const_int_expr", "const_float_expr", "const_string_expr",
-  "const_bool_expr", "';'", "','", "'('", "')'", "'{'", "'}'", "$accept",
-  "program", "decl", "decl_list", "variableDecl", "variableDecl_list",
-  "variable", "variable_list", "callDecl", "stmtBlock", "stmt",
-  "stmt_list", "ifStmt", "whileStmt", "forStmt", "returnStmt",
-  "continueStmt", "breakStmt", "expr", "call", "actual", "actual_list", YY_NULLPTR
+  "\"end of file\"", "error", "\"invalid token\"", "IF", "ELSE", "WHILE",
+  "FOR", "BREAK", "CONTINUE", "FUNC", "RETURN", "VAR", "ERROR", "AND",
+  "OR", "EQUAL", "NE", "GE", "LE", "INT", "STRING", "BOOL", "FLOAT",
+  "CONST_BOOL", "CONST_INT", "CONST_STRING", "CONST_FLOAT", "OBJECTID",
+  "TYPEID", "UMINUS", "'='", "'>'", "'<'", "'+'", "'-'", "'*'", "'/'",
+  "'%'", "'!'", "'~'", "'&'", "'|'", "'^'", "neg_expr", "bracket_expr",
+  "call_expr", "object_expr", "const_int_expr", "const_float_expr",
+  "const_string_expr", "const_bool_expr", "';'", "','", "'('", "')'",
+  "'{'", "'}'", "$accept", "program", "decl", "decl_list", "variableDecl",
+  "variableDecl_list", "variable", "variable_list", "callDecl",
+  "stmtBlock", "stmt", "stmt_list", "ifStmt", "whileStmt", "forStmt",
+  "returnStmt", "continueStmt", "breakStmt", "expr", "call", "actual",
+  "actual_list", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   286,   258,   260,   261,   262,   263,   264,   265,
-     266,   271,   273,   274,   275,   276,   277,   278,   279,   280,
-     281,   282,   283,   267,   268,   269,   270,   284,   285,   287,
-      61,    62,    60,    43,    45,    42,    47,    37,    33,   126,
-      38,   124,    94,   288,   289,   290,   291,   292,   293,   294,
-     295,    59,    44,    40,    41,   123,   125
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
 #define YYPACT_NINF (-49)
 
@@ -764,8 +667,8 @@ static const yytype_int16 yytoknum[] =
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
       -7,    -4,     4,     8,   -49,    -7,   -49,   -49,   -18,    14,
@@ -784,9 +687,9 @@ static const yytype_int16 yypact[] =
      -49,   250,    54,   -49,   -49,   -49,   -49,   250,   -49
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int8 yydefact[] =
 {
        0,     0,     0,     0,     5,     2,     3,     4,     0,     0,
@@ -805,7 +708,7 @@ static const yytype_int8 yydefact[] =
       39,     0,     0,    76,    34,    35,    36,     0,    33
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
      -49,   -49,    67,   -49,   -13,   -49,    12,   -49,   -49,   -21,
@@ -813,17 +716,17 @@ static const yytype_int8 yypgoto[] =
      -48,   -49
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,     3,     4,     5,     6,    42,    10,    17,     7,    43,
+       0,     3,     4,     5,     6,    42,    10,    17,     7,    43,
       44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
       98,    99
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
       23,    62,     1,    72,     2,    54,    55,    57,    11,    41,
@@ -950,8 +853,8 @@ static const yytype_int16 yycheck[] =
       33,    34,    35,    36,    37,    -1,    -1,    40,    41,    42
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
        0,     9,    11,    58,    59,    60,    61,    65,    27,    27,
@@ -970,7 +873,7 @@ static const yytype_int8 yystos[] =
       66,    75,    51,    77,    66,    66,    66,    75,    66
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
        0,    57,    58,    59,    59,    60,    60,    61,    62,    62,
@@ -983,7 +886,7 @@ static const yytype_int8 yyr1[] =
       75,    75,    76,    77,    78,    78,    78
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     1,     1,     1,     2,     3,     1,     2,
@@ -997,14 +900,15 @@ static const yytype_int8 yyr2[] =
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -1021,15 +925,14 @@ static const yytype_int8 yyr2[] =
       }                                                           \
     else                                                          \
       {                                                           \
-        yyerror (YY_("syntax error: cannot back up")); \
+        yyerror (&yylloc, ctx, YY_("syntax error: cannot back up")); \
         YYERROR;                                                  \
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -1073,12 +976,19 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
@@ -1106,24 +1016,32 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
 
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location); \
+                  Kind, Value, Location, ctx); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -1134,19 +1052,17 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ParseContext *ctx)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
-  YYUSE (yylocationp);
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (ctx);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -1156,14 +1072,15 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YY
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ParseContext *ctx)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyo, *yylocationp);
+  YYLOCATION_PRINT (yyo, yylocationp);
   YYFPRINTF (yyo, ": ");
-  yy_symbol_value_print (yyo, yytype, yyvaluep, yylocationp);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, ctx);
   YYFPRINTF (yyo, ")");
 }
 
@@ -1196,7 +1113,8 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, ParseContext *ctx)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -1208,9 +1126,9 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[+yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), ctx);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1218,15 +1136,15 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, ctx); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1247,330 +1165,214 @@ int yydebug;
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
+/* Parser data structure.  */
+struct yypstate
+  {
+    /* Number of syntax errors so far.  */
+    int yynerrs;
 
+    yy_state_fast_t yystate;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus;
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-#  else
-/* Return the length of YYSTR.  */
-static YYPTRDIFF_T
-yystrlen (const char *yystr)
-{
-  YYPTRDIFF_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize;
 
-  return yyd - 1;
-}
-#  endif
-# endif
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss;
+    yy_state_t *yyssp;
 
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYPTRDIFF_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYPTRDIFF_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (yyres)
-    return yystpcpy (yyres, yystr) - yyres;
-  else
-    return yystrlen (yystr);
-}
-# endif
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs;
+    YYSTYPE *yyvsp;
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls;
+    YYLTYPE *yylsp;
+    /* Whether this instance has not started parsing yet.
+     * If 2, it corresponds to a finished parsing.  */
+    int yynew;
+  };
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                yy_state_t *yyssp, int yytoken)
-{
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Actual size of YYARG. */
-  int yycount = 0;
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[+*yyssp];
-      YYPTRDIFF_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-      yysize = yysize0;
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYPTRDIFF_T yysize1
-                    = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    /* Don't count the "%s"s in the final size, but reserve room for
-       the terminator.  */
-    YYPTRDIFF_T yysize1 = yysize + (yystrlen (yyformat) - 2 * yycount) + 1;
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          ++yyp;
-          ++yyformat;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, ParseContext *ctx)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (ctx);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
 
 
-/* The lookahead symbol.  */
-int yychar;
 
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Location data for the lookahead symbol.  */
-YYLTYPE yylloc
+int
+yyparse (ParseContext *ctx)
+{
+  yypstate *yyps = yypstate_new ();
+  if (!yyps)
+    {
+      static YYLTYPE yyloc_default
 # if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
   = { 1, 1, 1, 1 }
 # endif
 ;
-/* Number of syntax errors so far.  */
-int yynerrs;
+      YYLTYPE yylloc = yyloc_default;
+      yyerror (&yylloc, ctx, YY_("memory exhausted"));
+      return 2;
+    }
+  int yystatus = yypull_parse (yyps, ctx);
+  yypstate_delete (yyps);
+  return yystatus;
+}
 
+int
+yypull_parse (yypstate *yyps, ParseContext *ctx)
+{
+  YY_ASSERT (yyps);
+  static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+  YYLTYPE yylloc = yyloc_default;
+  int yystatus;
+  do {
+    YYSTYPE yylval;
+    int yychar = yylex (&yylval, &yylloc, ctx);
+    yystatus = yypush_parse (yyps, yychar, &yylval, &yylloc, ctx);
+  } while (yystatus == YYPUSH_MORE);
+  return yystatus;
+}
 
-/*----------.
-| yyparse.  |
-`----------*/
+#define seal_yynerrs yyps->seal_yynerrs
+#define yystate yyps->yystate
+#define yyerrstatus yyps->yyerrstatus
+#define yyssa yyps->yyssa
+#define yyss yyps->yyss
+#define yyssp yyps->yyssp
+#define yyvsa yyps->yyvsa
+#define yyvs yyps->yyvs
+#define yyvsp yyps->yyvsp
+#define yylsa yyps->yylsa
+#define yyls yyps->yyls
+#define yylsp yyps->yylsp
+#define yystacksize yyps->yystacksize
+
+/* Initialize the parser data structure.  */
+static void
+yypstate_clear (yypstate *yyps)
+{
+  yynerrs = 0;
+  yystate = 0;
+  yyerrstatus = 0;
 
-int
-yyparse (void)
+  yyssp = yyss;
+  yyvsp = yyvs;
+  yylsp = yyls;
+
+  /* Initialize the state stack, in case yypcontext_expected_tokens is
+     called before the first call to yyparse. */
+  *yyssp = 0;
+  yyps->yynew = 1;
+}
+
+/* Initialize the parser data structure.  */
+yypstate *
+yypstate_new (void)
 {
-    yy_state_fast_t yystate;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+  yypstate *yyps;
+  yyps = YY_CAST (yypstate *, YYMALLOC (sizeof *yyps));
+  if (!yyps)
+    return YY_NULLPTR;
+  yystacksize = YYINITDEPTH;
+  yyss = yyssa;
+  yyvs = yyvsa;
+  yyls = yylsa;
+  yypstate_clear (yyps);
+  return yyps;
+}
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
+void
+yypstate_delete (yypstate *yyps)
+{
+  if (yyps)
+    {
+#ifndef yyoverflow
+      /* If the stack was reallocated but the parse did not complete, then the
+         stack still needs to be freed.  */
+      if (yyss != yyssa)
+        YYSTACK_FREE (yyss);
+#endif
+      YYFREE (yyps);
+    }
+}
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+/*---------------.
+| yypush_parse.  |
+`---------------*/
 
-    /* The location stack.  */
-    YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
+int
+yypush_parse (yypstate *yyps,
+              int yypushed_char, YYSTYPE const *yypushed_val, YYLTYPE *yypushed_loc, ParseContext *ctx)
+{
+/* Lookahead token kind.  */
+int yychar;
 
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
 
-    YYPTRDIFF_T yystacksize;
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -1578,18 +1380,25 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
+  switch (yyps->yynew)
+    {
+    case 0:
+      yyn = yypact[yystate];
+      goto yyread_pushed_token;
+
+    case 2:
+      yypstate_clear (yyps);
+      break;
+
+    default:
+      break;
+    }
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
-  yylsp[0] = yylloc;
+
+  yylsp[0] = *yypushed_loc;
   goto yysetstate;
 
 
@@ -1611,10 +1420,11 @@ yysetstate:
   YY_IGNORE_USELESS_CAST_BEGIN
   *yyssp = YY_CAST (yy_state_t, yystate);
   YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -1645,7 +1455,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -1656,11 +1466,11 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -1680,6 +1490,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -1700,18 +1511,42 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = yylex ();
+      if (!yyps->yynew)
+        {
+          YYDPRINTF ((stderr, "Return for a new token:\n"));
+          yyresult = YYPUSH_MORE;
+          goto yypushreturn;
+        }
+      yyps->yynew = 0;
+yyread_pushed_token:
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yypushed_char;
+      if (yypushed_val)
+        yylval = *yypushed_val;
+      if (yypushed_loc)
+        yylloc = *yypushed_loc;
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1783,613 +1618,615 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 2:
-#line 191 "seal.y"
+  case 2: /* program: decl_list  */
+#line 174 "seal.y"
                         {
       (yyloc) = (yylsp[0]);
-      ast_root = program((yyvsp[0].decls)); 
+      ctx->ast_root = program((yyloc), (yyvsp[0].decls)); 
     }
-#line 1793 "seal.tab.c"
+#line 1628 "seal.tab.c"
     break;
 
-  case 3:
-#line 198 "seal.y"
+  case 3: /* decl: variableDecl  */
+#line 181 "seal.y"
                          {
       (yyval.decl) = (yyvsp[0].variableDecl);
     }
-#line 1801 "seal.tab.c"
+#line 1636 "seal.tab.c"
     break;
 
-  case 4:
-#line 201 "seal.y"
+  case 4: /* decl: callDecl  */
+#line 184 "seal.y"
                {
       (yyval.decl) = (yyvsp[0].callDecl);      
     }
-#line 1809 "seal.tab.c"
+#line 1644 "seal.tab.c"
     break;
 
-  case 5:
-#line 207 "seal.y"
+  case 5: /* decl_list: decl  */
+#line 190 "seal.y"
                      {
+      if (ctx->decl_handler) ctx->decl_handler((yyvsp[0].decl));
       (yyval.decls) = single_Decls((yyvsp[0].decl));
     }
-#line 1817 "seal.tab.c"
+#line 1653 "seal.tab.c"
     break;
 
-  case 6:
-#line 210 "seal.y"
+  case 6: /* decl_list: decl_list decl  */
+#line 194 "seal.y"
                      {
+      if (ctx->decl_handler) ctx->decl_handler((yyvsp[0].decl));
       (yyval.decls) = append_Decls((yyvsp[-1].decls), single_Decls((yyvsp[0].decl)));
     }
-#line 1825 "seal.tab.c"
+#line 1662 "seal.tab.c"
     break;
 
-  case 7:
-#line 216 "seal.y"
+  case 7: /* variableDecl: VAR variable ';'  */
+#line 201 "seal.y"
                                      {
-      (yyval.variableDecl) = variableDecl((yyvsp[-1].variable));
+      (yyval.variableDecl) = variableDecl((yyloc), (yyvsp[-1].variable));
     }
-#line 1833 "seal.tab.c"
+#line 1670 "seal.tab.c"
     break;
 
-  case 8:
-#line 222 "seal.y"
+  case 8: /* variableDecl_list: variableDecl  */
+#line 207 "seal.y"
                                      {
       (yyval.variableDecls) = single_VariableDecls((yyvsp[0].variableDecl));
     }
-#line 1841 "seal.tab.c"
+#line 1678 "seal.tab.c"
     break;
 
-  case 9:
-#line 225 "seal.y"
+  case 9: /* variableDecl_list: variableDecl_list variableDecl  */
+#line 210 "seal.y"
                                      {
       (yyval.variableDecls) = append_VariableDecls((yyvsp[-1].variableDecls), single_VariableDecls((yyvsp[0].variableDecl)));
     }
-#line 1849 "seal.tab.c"
+#line 1686 "seal.tab.c"
     break;
 
-  case 10:
-#line 231 "seal.y"
+  case 10: /* variable: OBJECTID TYPEID  */
+#line 216 "seal.y"
                                 {
-      (yyval.variable) = variable((yyvsp[-1].symbol), (yyvsp[0].symbol));
+      (yyval.variable) = variable((yyloc), (yyvsp[-1].symbol), (yyvsp[0].symbol));
     }
-#line 1857 "seal.tab.c"
+#line 1694 "seal.tab.c"
     break;
 
-  case 11:
-#line 237 "seal.y"
+  case 11: /* variable_list: %empty  */
+#line 222 "seal.y"
                            {
       (yyval.variables) = nil_Variables();
     }
-#line 1865 "seal.tab.c"
+#line 1702 "seal.tab.c"
     break;
 
-  case 12:
-#line 240 "seal.y"
+  case 12: /* variable_list: variable  */
+#line 225 "seal.y"
                {
       (yyval.variables) = single_Variables((yyvsp[0].variable));
     }
-#line 1873 "seal.tab.c"
+#line 1710 "seal.tab.c"
     break;
 
-  case 13:
-#line 243 "seal.y"
+  case 13: /* variable_list: variable_list ',' variable  */
+#line 228 "seal.y"
                                  {
       (yyval.variables) = append_Variables((yyvsp[-2].variables), single_Variables((yyvsp[0].variable)));
     }
-#line 1881 "seal.tab.c"
+#line 1718 "seal.tab.c"
     break;
 
-  case 14:
-#line 249 "seal.y"
+  case 14: /* callDecl: FUNC OBJECTID '(' variable_list ')' TYPEID stmtBlock  */
+#line 234 "seal.y"
                                                                      {     
-      (yyval.callDecl) = callDecl((yyvsp[-5].symbol), (yyvsp[-3].variables), (yyvsp[-1].symbol), (yyvsp[0].stmtBlock));
+      (yyval.callDecl) = callDecl((yyloc), (yyvsp[-5].symbol), (yyvsp[-3].variables), (yyvsp[-1].symbol), (yyvsp[0].stmtBlock));
     }
-#line 1889 "seal.tab.c"
+#line 1726 "seal.tab.c"
     break;
 
-  case 15:
-#line 255 "seal.y"
+  case 15: /* stmtBlock: '{' variableDecl_list stmt_list '}'  */
+#line 240 "seal.y"
                                                     {
-      (yyval.stmtBlock) = stmtBlock((yyvsp[-2].variableDecls), (yyvsp[-1].stmts));
+      (yyval.stmtBlock) = stmtBlock((yyloc), (yyvsp[-2].variableDecls), (yyvsp[-1].stmts));
     }
-#line 1897 "seal.tab.c"
+#line 1734 "seal.tab.c"
     break;
 
-  case 16:
-#line 258 "seal.y"
+  case 16: /* stmtBlock: '{' stmt_list '}'  */
+#line 243 "seal.y"
                         {
-      (yyval.stmtBlock) = stmtBlock(nil_VariableDecls(), (yyvsp[-1].stmts));
+      (yyval.stmtBlock) = stmtBlock((yyloc), nil_VariableDecls(), (yyvsp[-1].stmts));
     }
-#line 1905 "seal.tab.c"
+#line 1742 "seal.tab.c"
     break;
 
-  case 17:
-#line 261 "seal.y"
+  case 17: /* stmtBlock: '{' variableDecl_list '}'  */
+#line 246 "seal.y"
                                 {
-      (yyval.stmtBlock) = stmtBlock((yyvsp[-1].variableDecls), nil_Stmts());
+      (yyval.stmtBlock) = stmtBlock((yyloc), (yyvsp[-1].variableDecls), nil_Stmts());
     }
-#line 1913 "seal.tab.c"
+#line 1750 "seal.tab.c"
     break;
 
-  case 18:
-#line 264 "seal.y"
+  case 18: /* stmtBlock: '{' '}'  */
+#line 249 "seal.y"
               {
-      (yyval.stmtBlock) = stmtBlock(nil_VariableDecls(), nil_Stmts());
+      (yyval.stmtBlock) = stmtBlock((yyloc), nil_VariableDecls(), nil_Stmts());
     }
-#line 1921 "seal.tab.c"
+#line 1758 "seal.tab.c"
     break;
 
-  case 19:
-#line 270 "seal.y"
+  case 19: /* stmt: ';'  */
+#line 255 "seal.y"
                 {
-      (yyval.stmt) = no_expr();
+      (yyval.stmt) = no_expr((yyloc));
     }
-#line 1929 "seal.tab.c"
+#line 1766 "seal.tab.c"
     break;
 
-  case 20:
-#line 273 "seal.y"
+  case 20: /* stmt: expr ';'  */
+#line 258 "seal.y"
                {
       (yyval.stmt) = (yyvsp[-1].expr);
     }
-#line 1937 "seal.tab.c"
+#line 1774 "seal.tab.c"
     break;
 
-  case 21:
-#line 276 "seal.y"
+  case 21: /* stmt: ifStmt  */
+#line 261 "seal.y"
              {
       (yyval.stmt) = (yyvsp[0].ifStmt);
     }
-#line 1945 "seal.tab.c"
+#line 1782 "seal.tab.c"
     break;
 
-  case 22:
-#line 279 "seal.y"
+  case 22: /* stmt: whileStmt  */
+#line 264 "seal.y"
                 {
       (yyval.stmt) = (yyvsp[0].whileStmt);      
     }
-#line 1953 "seal.tab.c"
+#line 1790 "seal.tab.c"
     break;
 
-  case 23:
-#line 282 "seal.y"
+  case 23: /* stmt: forStmt  */
+#line 267 "seal.y"
               {
       (yyval.stmt) = (yyvsp[0].forStmt);      
     }
-#line 1961 "seal.tab.c"
+#line 1798 "seal.tab.c"
     break;
 
-  case 24:
-#line 285 "seal.y"
+  case 24: /* stmt: breakStmt  */
+#line 270 "seal.y"
                 {
       (yyval.stmt) = (yyvsp[0].breakStmt);      
     }
-#line 1969 "seal.tab.c"
+#line 1806 "seal.tab.c"
     break;
 
-  case 25:
-#line 288 "seal.y"
+  case 25: /* stmt: continueStmt  */
+#line 273 "seal.y"
                    {
       (yyval.stmt) = (yyvsp[0].continueStmt);      
     }
-#line 1977 "seal.tab.c"
+#line 1814 "seal.tab.c"
     break;
 
-  case 26:
-#line 291 "seal.y"
+  case 26: /* stmt: returnStmt  */
+#line 276 "seal.y"
                  {
       (yyval.stmt) = (yyvsp[0].returnStmt);      
     }
-#line 1985 "seal.tab.c"
+#line 1822 "seal.tab.c"
     break;
 
-  case 27:
-#line 294 "seal.y"
+  case 27: /* stmt: stmtBlock  */
+#line 279 "seal.y"
                 {
       (yyval.stmt) = (yyvsp[0].stmtBlock);      
     }
-#line 1993 "seal.tab.c"
+#line 1830 "seal.tab.c"
     break;
 
-  case 28:
-#line 300 "seal.y"
+  case 28: /* stmt_list: stmt  */
+#line 285 "seal.y"
                      {
       (yyval.stmts) = single_Stmts((yyvsp[0].stmt));
     }
-#line 2001 "seal.tab.c"
+#line 1838 "seal.tab.c"
     break;
 
-  case 29:
-#line 303 "seal.y"
+  case 29: /* stmt_list: stmt_list stmt  */
+#line 288 "seal.y"
                      {
       (yyval.stmts) = append_Stmts((yyvsp[-1].stmts), single_Stmts((yyvsp[0].stmt)));
     }
-#line 2009 "seal.tab.c"
+#line 1846 "seal.tab.c"
     break;
 
-  case 30:
-#line 309 "seal.y"
+  case 30: /* ifStmt: IF expr stmtBlock ELSE stmtBlock  */
+#line 294 "seal.y"
                                                {
-      (yyval.ifStmt) = ifstmt((yyvsp[-3].expr), (yyvsp[-2].stmtBlock), (yyvsp[0].stmtBlock));
+      (yyval.ifStmt) = ifstmt((yyloc), (yyvsp[-3].expr), (yyvsp[-2].stmtBlock), (yyvsp[0].stmtBlock));
     }
-#line 2017 "seal.tab.c"
+#line 1854 "seal.tab.c"
     break;
 
-  case 31:
-#line 312 "seal.y"
+  case 31: /* ifStmt: IF expr stmtBlock  */
+#line 297 "seal.y"
                         {
-      (yyval.ifStmt) = ifstmt((yyvsp[-1].expr), (yyvsp[0].stmtBlock), stmtBlock(nil_VariableDecls(), nil_Stmts()));
+      (yyval.ifStmt) = ifstmt((yyloc), (yyvsp[-1].expr), (yyvsp[0].stmtBlock), stmtBlock((yyloc), nil_VariableDecls(), nil_Stmts()));
     }
-#line 2025 "seal.tab.c"
+#line 1862 "seal.tab.c"
     break;
 
-  case 32:
-#line 318 "seal.y"
+  case 32: /* whileStmt: WHILE expr stmtBlock  */
+#line 303 "seal.y"
                                      {
-      (yyval.whileStmt) = whilestmt((yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+      (yyval.whileStmt) = whilestmt((yyloc), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
     }
-#line 2033 "seal.tab.c"
+#line 1870 "seal.tab.c"
     break;
 
-  case 33:
-#line 324 "seal.y"
+  case 33: /* forStmt: FOR expr ';' expr ';' expr stmtBlock  */
+#line 309 "seal.y"
                                                    {
-      (yyval.forStmt) = forstmt((yyvsp[-5].expr), (yyvsp[-3].expr), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-5].expr), (yyvsp[-3].expr), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
     }
-#line 2041 "seal.tab.c"
+#line 1878 "seal.tab.c"
     break;
 
-  case 34:
-#line 327 "seal.y"
+  case 34: /* forStmt: FOR ';' expr ';' expr stmtBlock  */
+#line 312 "seal.y"
                                       {
-      (yyval.forStmt) = forstmt(no_expr(), (yyvsp[-3].expr), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), (yyvsp[-3].expr), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
     }
-#line 2049 "seal.tab.c"
+#line 1886 "seal.tab.c"
     break;
 
-  case 35:
-#line 330 "seal.y"
+  case 35: /* forStmt: FOR expr ';' ';' expr stmtBlock  */
+#line 315 "seal.y"
                                       {
-      (yyval.forStmt) = forstmt((yyvsp[-4].expr), no_expr(), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-4].expr), no_expr((yyloc)), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
     }
-#line 2057 "seal.tab.c"
+#line 1894 "seal.tab.c"
     break;
 
-  case 36:
-#line 333 "seal.y"
+  case 36: /* forStmt: FOR expr ';' expr ';' stmtBlock  */
+#line 318 "seal.y"
                                       {
-      (yyval.forStmt) = forstmt((yyvsp[-4].expr), (yyvsp[-2].expr), no_expr(), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-4].expr), (yyvsp[-2].expr), no_expr((yyloc)), (yyvsp[0].stmtBlock));
     }
-#line 2065 "seal.tab.c"
+#line 1902 "seal.tab.c"
     break;
 
-  case 37:
-#line 336 "seal.y"
+  case 37: /* forStmt: FOR ';' ';' expr stmtBlock  */
+#line 321 "seal.y"
                                  {
-      (yyval.forStmt) = forstmt(no_expr(), no_expr(), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), no_expr((yyloc)), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
     }
-#line 2073 "seal.tab.c"
+#line 1910 "seal.tab.c"
     break;
 
-  case 38:
-#line 339 "seal.y"
+  case 38: /* forStmt: FOR ';' expr ';' stmtBlock  */
+#line 324 "seal.y"
                                  {
-      (yyval.forStmt) = forstmt(no_expr(), (yyvsp[-2].expr), no_expr(), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), (yyvsp[-2].expr), no_expr((yyloc)), (yyvsp[0].stmtBlock));
     }
-#line 2081 "seal.tab.c"
+#line 1918 "seal.tab.c"
     break;
 
-  case 39:
-#line 342 "seal.y"
+  case 39: /* forStmt: FOR expr ';' ';' stmtBlock  */
+#line 327 "seal.y"
                                  {
-      (yyval.forStmt) = forstmt((yyvsp[-3].expr), no_expr(), no_expr(), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-3].expr), no_expr((yyloc)), no_expr((yyloc)), (yyvsp[0].stmtBlock));
     }
-#line 2089 "seal.tab.c"
+#line 1926 "seal.tab.c"
     break;
 
-  case 40:
-#line 345 "seal.y"
+  case 40: /* forStmt: FOR ';' ';' stmtBlock  */
+#line 330 "seal.y"
                             {
-      (yyval.forStmt) = forstmt(no_expr(), no_expr(), no_expr(), (yyvsp[0].stmtBlock));
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), no_expr((yyloc)), no_expr((yyloc)), (yyvsp[0].stmtBlock));
     }
-#line 2097 "seal.tab.c"
+#line 1934 "seal.tab.c"
     break;
 
-  case 41:
-#line 351 "seal.y"
+  case 41: /* returnStmt: RETURN expr ';'  */
+#line 336 "seal.y"
                                   {
-      (yyval.returnStmt) = returnstmt((yyvsp[-1].expr));
+      (yyval.returnStmt) = returnstmt((yyloc), (yyvsp[-1].expr));
     }
-#line 2105 "seal.tab.c"
+#line 1942 "seal.tab.c"
     break;
 
-  case 42:
-#line 354 "seal.y"
+  case 42: /* returnStmt: RETURN ';'  */
+#line 339 "seal.y"
                  {
-      (yyval.returnStmt) = returnstmt(no_expr());
+      (yyval.returnStmt) = returnstmt((yyloc), no_expr((yyloc)));
     }
-#line 2113 "seal.tab.c"
+#line 1950 "seal.tab.c"
     break;
 
-  case 43:
-#line 360 "seal.y"
+  case 43: /* continueStmt: CONTINUE ';'  */
+#line 345 "seal.y"
                                  {
-      (yyval.continueStmt) = continuestmt();
+      (yyval.continueStmt) = continuestmt((yyloc));
     }
-#line 2121 "seal.tab.c"
+#line 1958 "seal.tab.c"
     break;
 
-  case 44:
-#line 366 "seal.y"
+  case 44: /* breakStmt: BREAK ';'  */
+#line 351 "seal.y"
                           {
-      (yyval.breakStmt) = breakstmt();
+      (yyval.breakStmt) = breakstmt((yyloc));
     }
-#line 2129 "seal.tab.c"
+#line 1966 "seal.tab.c"
     break;
 
-  case 45:
-#line 372 "seal.y"
+  case 45: /* expr: OBJECTID '=' expr  */
+#line 357 "seal.y"
                               {
-      (yyval.expr) = assign((yyvsp[-2].symbol), (yyvsp[0].expr));
+      (yyval.expr) = assign((yyloc), (yyvsp[-2].symbol), (yyvsp[0].expr));
     }
-#line 2137 "seal.tab.c"
+#line 1974 "seal.tab.c"
     break;
 
-  case 46:
-#line 375 "seal.y"
+  case 46: /* expr: CONST_BOOL  */
+#line 360 "seal.y"
                                        {
-      (yyval.expr) = const_bool((yyvsp[0].boolean));
+      (yyval.expr) = const_bool((yyloc), (yyvsp[0].boolean));
     }
-#line 2145 "seal.tab.c"
+#line 1982 "seal.tab.c"
     break;
 
-  case 47:
-#line 378 "seal.y"
+  case 47: /* expr: CONST_INT  */
+#line 363 "seal.y"
                                      {
-      (yyval.expr) = const_int((yyvsp[0].symbol));
+      (yyval.expr) = const_int((yyloc), (yyvsp[0].symbol));
     }
-#line 2153 "seal.tab.c"
+#line 1990 "seal.tab.c"
     break;
 
-  case 48:
-#line 381 "seal.y"
+  case 48: /* expr: CONST_STRING  */
+#line 366 "seal.y"
                                            {
-      (yyval.expr) = const_string((yyvsp[0].symbol));
+      (yyval.expr) = const_string((yyloc), (yyvsp[0].symbol));
     }
-#line 2161 "seal.tab.c"
+#line 1998 "seal.tab.c"
     break;
 
-  case 49:
-#line 384 "seal.y"
+  case 49: /* expr: CONST_FLOAT  */
+#line 369 "seal.y"
                                          {
-      (yyval.expr) = const_float((yyvsp[0].symbol));
+      (yyval.expr) = const_float((yyloc), (yyvsp[0].symbol));
     }
-#line 2169 "seal.tab.c"
+#line 2006 "seal.tab.c"
     break;
 
-  case 50:
-#line 387 "seal.y"
+  case 50: /* expr: call  */
+#line 372 "seal.y"
                            {
       (yyval.expr) = (yyvsp[0].call);
     }
-#line 2177 "seal.tab.c"
+#line 2014 "seal.tab.c"
     break;
 
-  case 51:
-#line 390 "seal.y"
+  case 51: /* expr: '(' expr ')'  */
+#line 375 "seal.y"
                                       {
       (yyval.expr) = (yyvsp[-1].expr);
     }
-#line 2185 "seal.tab.c"
+#line 2022 "seal.tab.c"
     break;
 
-  case 52:
-#line 393 "seal.y"
+  case 52: /* expr: OBJECTID  */
+#line 378 "seal.y"
                                  {
-      (yyval.expr) = object((yyvsp[0].symbol));
+      (yyval.expr) = object((yyloc), (yyvsp[0].symbol));
     }
-#line 2193 "seal.tab.c"
+#line 2030 "seal.tab.c"
     break;
 
-  case 53:
-#line 396 "seal.y"
+  case 53: /* expr: expr '+' expr  */
+#line 381 "seal.y"
                     {
-      (yyval.expr) = add((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = add((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2201 "seal.tab.c"
+#line 2038 "seal.tab.c"
     break;
 
-  case 54:
-#line 399 "seal.y"
+  case 54: /* expr: expr '-' expr  */
+#line 384 "seal.y"
                     {
-      (yyval.expr) = minus((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = minus((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2209 "seal.tab.c"
+#line 2046 "seal.tab.c"
     break;
 
-  case 55:
-#line 402 "seal.y"
+  case 55: /* expr: expr '*' expr  */
+#line 387 "seal.y"
                     {
-      (yyval.expr) = multi((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = multi((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2217 "seal.tab.c"
+#line 2054 "seal.tab.c"
     break;
 
-  case 56:
-#line 405 "seal.y"
+  case 56: /* expr: expr '/' expr  */
+#line 390 "seal.y"
                     {
-      (yyval.expr) = divide((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = divide((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2225 "seal.tab.c"
+#line 2062 "seal.tab.c"
     break;
 
-  case 57:
-#line 408 "seal.y"
+  case 57: /* expr: expr '%' expr  */
+#line 393 "seal.y"
                     {
-      (yyval.expr) = mod((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = mod((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2233 "seal.tab.c"
+#line 2070 "seal.tab.c"
     break;
 
-  case 58:
-#line 411 "seal.y"
+  case 58: /* expr: '-' expr  */
+#line 396 "seal.y"
                               {
-      (yyval.expr) = neg((yyvsp[0].expr));
+      (yyval.expr) = neg((yyloc), (yyvsp[0].expr));
     }
-#line 2241 "seal.tab.c"
+#line 2078 "seal.tab.c"
     break;
 
-  case 59:
-#line 414 "seal.y"
+  case 59: /* expr: expr '<' expr  */
+#line 399 "seal.y"
                     {
-      (yyval.expr) = lt((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = lt((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2249 "seal.tab.c"
+#line 2086 "seal.tab.c"
     break;
 
-  case 60:
-#line 417 "seal.y"
+  case 60: /* expr: expr LE expr  */
+#line 402 "seal.y"
                    {
-      (yyval.expr) = le((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = le((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2257 "seal.tab.c"
+#line 2094 "seal.tab.c"
     break;
 
-  case 61:
-#line 420 "seal.y"
+  case 61: /* expr: expr EQUAL expr  */
+#line 405 "seal.y"
                       {
-      (yyval.expr) = equ((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = equ((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2265 "seal.tab.c"
+#line 2102 "seal.tab.c"
     break;
 
-  case 62:
-#line 423 "seal.y"
+  case 62: /* expr: expr NE expr  */
+#line 408 "seal.y"
                    {
-      (yyval.expr) = neq((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = neq((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2273 "seal.tab.c"
+#line 2110 "seal.tab.c"
     break;
 
-  case 63:
-#line 426 "seal.y"
+  case 63: /* expr: expr GE expr  */
+#line 411 "seal.y"
                    {
-      (yyval.expr) = ge((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = ge((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2281 "seal.tab.c"
+#line 2118 "seal.tab.c"
     break;
 
-  case 64:
-#line 429 "seal.y"
+  case 64: /* expr: expr '>' expr  */
+#line 414 "seal.y"
                     {
-      (yyval.expr) = gt((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = gt((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2289 "seal.tab.c"
+#line 2126 "seal.tab.c"
     break;
 
-  case 65:
-#line 432 "seal.y"
+  case 65: /* expr: expr AND expr  */
+#line 417 "seal.y"
                     {
-      (yyval.expr) = and_((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = and_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2297 "seal.tab.c"
+#line 2134 "seal.tab.c"
     break;
 
-  case 66:
-#line 435 "seal.y"
+  case 66: /* expr: expr OR expr  */
+#line 420 "seal.y"
                    {
-      (yyval.expr) = or_((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = or_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2305 "seal.tab.c"
+#line 2142 "seal.tab.c"
     break;
 
-  case 67:
-#line 438 "seal.y"
+  case 67: /* expr: expr '^' expr  */
+#line 423 "seal.y"
                     {
-      (yyval.expr) = xor_((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = xor_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2313 "seal.tab.c"
+#line 2150 "seal.tab.c"
     break;
 
-  case 68:
-#line 441 "seal.y"
+  case 68: /* expr: '!' expr  */
+#line 426 "seal.y"
                {
-      (yyval.expr) = not_((yyvsp[0].expr));
+      (yyval.expr) = not_((yyloc), (yyvsp[0].expr));
     }
-#line 2321 "seal.tab.c"
+#line 2158 "seal.tab.c"
     break;
 
-  case 69:
-#line 444 "seal.y"
+  case 69: /* expr: '~' expr  */
+#line 429 "seal.y"
                {
-      (yyval.expr) = bitnot((yyvsp[0].expr));
+      (yyval.expr) = bitnot((yyloc), (yyvsp[0].expr));
     }
-#line 2329 "seal.tab.c"
+#line 2166 "seal.tab.c"
     break;
 
-  case 70:
-#line 447 "seal.y"
+  case 70: /* expr: expr '&' expr  */
+#line 432 "seal.y"
                     {
-      (yyval.expr) = bitand_((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = bitand_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2337 "seal.tab.c"
+#line 2174 "seal.tab.c"
     break;
 
-  case 71:
-#line 450 "seal.y"
+  case 71: /* expr: expr '|' expr  */
+#line 435 "seal.y"
                     {
-      (yyval.expr) = bitor_((yyvsp[-2].expr), (yyvsp[0].expr));
+      (yyval.expr) = bitor_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
     }
-#line 2345 "seal.tab.c"
+#line 2182 "seal.tab.c"
     break;
 
-  case 72:
-#line 456 "seal.y"
+  case 72: /* call: OBJECTID '(' actual_list ')'  */
+#line 441 "seal.y"
                                          {
       if((yyvsp[-1].actuals) -> len() != 0) {
-        (yyval.call) = call((yyvsp[-3].symbol), (yyvsp[-1].actuals));
+        (yyval.call) = call((yyloc), (yyvsp[-3].symbol), (yyvsp[-1].actuals));
       } else {
-        (yyval.call) = call((yyvsp[-3].symbol), nil_Actuals());
+        (yyval.call) = call((yyloc), (yyvsp[-3].symbol), nil_Actuals());
       }      
     }
-#line 2357 "seal.tab.c"
+#line 2194 "seal.tab.c"
     break;
 
-  case 73:
-#line 466 "seal.y"
+  case 73: /* actual: expr  */
+#line 451 "seal.y"
                    {
-      (yyval.actual) = actual((yyvsp[0].expr));
+      (yyval.actual) = actual((yyloc), (yyvsp[0].expr));
     }
-#line 2365 "seal.tab.c"
+#line 2202 "seal.tab.c"
     break;
 
-  case 74:
-#line 472 "seal.y"
+  case 74: /* actual_list: %empty  */
+#line 457 "seal.y"
                          {
       (yyval.actuals) = nil_Actuals();
     }
-#line 2373 "seal.tab.c"
+#line 2210 "seal.tab.c"
     break;
 
-  case 75:
-#line 475 "seal.y"
+  case 75: /* actual_list: actual  */
+#line 460 "seal.y"
              {
       (yyval.actuals) = single_Actuals((yyvsp[0].actual));
     }
-#line 2381 "seal.tab.c"
+#line 2218 "seal.tab.c"
     break;
 
-  case 76:
-#line 478 "seal.y"
+  case 76: /* actual_list: actual_list ',' actual  */
+#line 463 "seal.y"
                              {
       (yyval.actuals) = append_Actuals((yyvsp[-2].actuals), single_Actuals((yyvsp[0].actual)));
     }
-#line 2389 "seal.tab.c"
+#line 2226 "seal.tab.c"
     break;
 
 
-#line 2393 "seal.tab.c"
+#line 2230 "seal.tab.c"
 
       default: break;
     }
@@ -2404,11 +2241,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -2433,50 +2269,15 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *, YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
+      yyerror (&yylloc, ctx, YY_("syntax error"));
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2491,7 +2292,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval, &yylloc);
+                      yytoken, &yylval, &yylloc, ctx);
           yychar = YYEMPTY;
         }
     }
@@ -2509,6 +2310,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -2525,13 +2327,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2545,7 +2348,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, ctx);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2556,13 +2359,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2573,7 +2374,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -2581,31 +2382,29 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (&yylloc, ctx, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval, &yylloc);
+                  yytoken, &yylval, &yylloc, ctx);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -2614,32 +2413,69 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[+*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, ctx);
       YYPOPSTACK (1);
     }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+  yyps->yynew = 2;
+  goto yypushreturn;
+
+
+/*-------------------------.
+| yypushreturn -- return.  |
+`-------------------------*/
+yypushreturn:
+
   return yyresult;
 }
-#line 485 "seal.y"
+#undef seal_yynerrs
+#undef yystate
+#undef yyerrstatus
+#undef yyssa
+#undef yyss
+#undef yyssp
+#undef yyvsa
+#undef yyvs
+#undef yyvsp
+#undef yylsa
+#undef yyls
+#undef yylsp
+#undef yystacksize
+#line 470 "seal.y"
 
     
     /* This function is called automatically when Bison detects a parse error. */
-    void yyerror(char *s)
+    static const DiagKind syntax_error =
+      { "syntax-error", "\"{0}\", line {line}: {1} at or near {2}\n" };
+
+    void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s)
     {
-      extern int curr_lineno;
-      
-      cerr << "\"" << curr_filename << "\", line " << curr_lineno << ": " \
-      << s << " at or near ";
-      print_seal_token(yychar);
-      cerr << endl;
-      omerrs++;
+      std::ostringstream token;
+      print_seal_token(token, ctx->last_token);
+      ctx->diags->report(*llocp, syntax_error) << ctx->filename << s << token.str();
+      ctx->omerrs++;
       
-      if(omerrs>50) {fprintf(stdout, "More than 50 errors\n"); exit(1);}
+      if(ctx->omerrs>50) {ctx->diags->flush(); fprintf(stdout, "More than 50 errors\n"); ctx->diags->stop(1);}
+    }
+
+    /* 
+     * Drive the push parser with tokens pulled from the lexer.  The lexer
+     * consumes its input as it arrives, so when fin is a pipe every complete
+     * top-level declaration reaches ctx->decl_handler while the producer is
+     * still writing the rest of the program.  Returns 0 on success like
+     * seal_yyparse().
+     */
+    int seal_yyparse_stream(ParseContext *ctx)
+    {
+      seal_yypstate *ps = seal_yypstate_new();
+      YYSTYPE lval;
+      YYLTYPE lloc;
+      int status;
+
+      do {
+        int token = seal_yylex(&lval, &lloc, ctx);
+        status = seal_yypush_parse(ps, token, &lval, &lloc, ctx);
+      } while (status == YYPUSH_MORE);
+
+      seal_yypstate_delete(ps);
+      return status;
     }
@@ -0,0 +1,985 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include "seal-decl.h"
+#include "seal-stmt.h"
+#include "seal-expr.h"
+#include "seal-parse.h"
+#include "parse_context.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  seal-rdparse.cc
+//
+//  A hand-written parser for SEAL, selected with -R.  It accepts exactly the
+//  language of seal.y and builds the same tree through the same
+//  constructors: statements and declarations are parsed by recursive
+//  descent, expressions by precedence climbing (Pratt parsing) over the
+//  precedence table of seal.y.
+//
+//  Line numbers follow the rule of seal.y: a node gets the line of the
+//  first token of the construct it was reduced from.  For a binary
+//  operator that is the first token of its left operand, which is not
+//  always the line of the operand node: in "(\n a) + b" the Add gets the
+//  line of "(" and the Object the line of "a".  The expression routines
+//  therefore return that location beside the node.
+//
+//  Like seal_yyparse() the parser stops at the first syntax error, which it
+//  reports through seal_yyerror() on the same token, and returns 1.
+//
+//  The same parser does outline parsing (-L, seal_outline_parse): the whole
+//  source is read into memory and scanned in place, and at the '{' of a
+//  function body the parser only matches braces to find its end, records
+//  the range in a LazyBody and restarts the scanner after it.  The body is
+//  parsed when CallDecl_class::getBody() is first called.  Where braces do
+//  not balance, the range found that way is not the one a full parse would
+//  read as the body, and the outline parse, or the body, fails somewhere
+//  else than a full parse would.  Neither reports such an error: the text
+//  is parsed again without skipping, from the start for the outline parse
+//  and from the declaration for a body, and the error found then is the
+//  one reported.  Everything before that parsed as a full parse would have
+//  parsed it, so this is the first error a full parse finds.
+//
+//  seal_reparse() parses a file again after an edit.  It cuts the source
+//  into one region per top-level declaration, each starting at a "func"
+//  or "var" outside braces.  Comparing the text with that of the previous
+//  parse gives an unchanged head and tail: the regions in the head are
+//  kept as they are, and the regions in the tail keep their trees, moved
+//  with shift_lines() to the line where they now start.  Only the text in
+//  between is cut again, up to the first boundary that falls on an old
+//  region of the tail; its regions are looked up by hash among the old
+//  ones there, compared byte for byte, and only new or edited regions are
+//  parsed.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <vector>
+#include <map>
+
+extern thread_local int curr_lineno;
+int seal_yylex();
+
+// from the flex scanner in seal-lex.cc
+extern thread_local char *yytext;
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+YY_BUFFER_STATE yy_scan_buffer(char *base, size_t size);
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, size_t len);
+void yy_delete_buffer(YY_BUFFER_STATE b);
+void yypush_buffer_state(YY_BUFFER_STATE b);
+void yypop_buffer_state();
+
+//
+// The parsers below scan text in memory.  The scan functions put a buffer
+// for it on top of flex's buffer stack, so that whatever was being scanned
+// before (the file, or the source of an outline parse that is forcing a
+// body) carries on after end_scan().  yy_scan_*() would replace the top
+// buffer instead, so they are called with a placeholder pushed there.
+//
+static YY_BUFFER_STATE scan_copy(const char *text, int len)
+{
+    YY_BUFFER_STATE slot = yy_create_buffer(NULL, 2);
+    yypush_buffer_state(slot);
+    YY_BUFFER_STATE b = yy_scan_bytes(text, len);
+    yy_delete_buffer(slot);
+    return b;
+}
+
+// text is scanned in place; its last two bytes must be NULs
+static YY_BUFFER_STATE scan_in_place(char *text, int size)
+{
+    YY_BUFFER_STATE slot = yy_create_buffer(NULL, 2);
+    yypush_buffer_state(slot);
+    YY_BUFFER_STATE b = yy_scan_buffer(text, size);
+    yy_delete_buffer(slot);
+    return b;
+}
+
+static void end_scan()
+{
+    yypop_buffer_state();
+}
+
+//
+// Binding power of the binary operators, from the precedence declarations
+// of seal.y.  All of them associate to the left.  '=' is not here: it is
+// only ever seen right after an identifier and handled in parse_prefix().
+//
+enum {
+    PREC_NONE = 0,
+    PREC_OR,
+    PREC_AND,
+    PREC_EQUALITY,      // EQUAL NE
+    PREC_RELATION,      // '>' GE '<' LE
+    PREC_ADDITIVE,      // '+' '-'
+    PREC_MULTIPLICATIVE,// '*' '/' '%'
+    PREC_NOT,           // unary '!'
+    PREC_BIT,           // unary '~', '&' '|' '^'
+    PREC_NEG            // unary '-'
+};
+
+static int binary_prec(int token)
+{
+    switch (token) {
+    case OR:                            return PREC_OR;
+    case AND:                           return PREC_AND;
+    case EQUAL: case NE:                return PREC_EQUALITY;
+    case '>': case GE: case '<': case LE: return PREC_RELATION;
+    case '+': case '-':                 return PREC_ADDITIVE;
+    case '*': case '/': case '%':       return PREC_MULTIPLICATIVE;
+    case '&': case '|': case '^':       return PREC_BIT;
+    default:                            return PREC_NONE;
+    }
+}
+
+static Expr binary(int token, int line, Expr e1, Expr e2)
+{
+    switch (token) {
+    case OR:    return or_(line, e1, e2);
+    case AND:   return and_(line, e1, e2);
+    case EQUAL: return equ(line, e1, e2);
+    case NE:    return neq(line, e1, e2);
+    case '>':   return gt(line, e1, e2);
+    case GE:    return ge(line, e1, e2);
+    case '<':   return lt(line, e1, e2);
+    case LE:    return le(line, e1, e2);
+    case '+':   return add(line, e1, e2);
+    case '-':   return minus(line, e1, e2);
+    case '*':   return multi(line, e1, e2);
+    case '/':   return divide(line, e1, e2);
+    case '%':   return mod(line, e1, e2);
+    case '&':   return bitand_(line, e1, e2);
+    case '|':   return bitor_(line, e1, e2);
+    default:    return xor_(line, e1, e2);
+    }
+}
+
+// thrown on the first syntax error to unwind to seal_rdparse()
+struct syntax_error { };
+
+class RDParser {
+private:
+    ParseContext *ctx;
+    int token;          // the lookahead
+    int token_line;     // its line
+    YYSTYPE token_val;  // its semantic value
+    int token_offset;   // outline mode: where it starts in text
+
+    // outline mode: text is the source, scanned in place in scan_text
+    const char *text;
+    char *scan_text;
+    int text_len;
+    YY_BUFFER_STATE scan_buffer;
+
+    bool quiet;         // do not report syntax errors
+
+    void advance();
+    void expect(int t);
+    void error();
+
+    Decl parse_decl();
+    VariableDecl parse_variableDecl();
+    Variable parse_variable();
+    CallDecl parse_callDecl();
+    bool skip_body(CallDecl decl, int decl_begin, int decl_line);
+    StmtBlock parse_stmtBlock();
+    Stmt parse_stmt();
+    Stmt parse_ifStmt();
+    Stmt parse_whileStmt();
+    Stmt parse_forStmt();
+    Stmt parse_returnStmt();
+    Expr parse_expr(int min_prec, int &loc);
+    Expr parse_prefix(int &loc);
+    Expr parse_call(int line, Symbol name);
+    Actual parse_actual();
+
+public:
+    RDParser(ParseContext *c) : ctx(c), token(0), token_line(0),
+                                token_offset(0), text(NULL),
+                                scan_text(NULL), text_len(0), scan_buffer(NULL),
+                                quiet(false) { }
+    Program parse_program();
+    Program parse_outline(const char *source, int len);
+    StmtBlock parse_body(LazyBody *b);
+    Program parse_text(const char *source, int len, int line = 1);
+    Decl parse_region(const char *source, int len, int line);
+};
+
+void RDParser::advance()
+{
+    token = seal_yylex();
+    token_val = seal_yylval;
+    token_line = curr_lineno;
+    // yytext moves on when a body is forced while this parse runs
+    if (scan_text != NULL)
+        token_offset = yytext - scan_text;
+    ctx->last_token = token;
+}
+
+void RDParser::expect(int t)
+{
+    if (token != t)
+        error();
+    advance();
+}
+
+void RDParser::error()
+{
+    if (!quiet)
+        seal_yyerror(&token_line, ctx, "syntax error");
+    throw syntax_error();
+}
+
+//
+// program : decl_list
+//
+Program RDParser::parse_program()
+{
+    advance();
+    int line = token_line;
+    Decls decls = NULL;
+    do {
+        Decl d = parse_decl();
+        if (ctx->decl_handler) ctx->decl_handler(d);
+        decls = decls ? append_Decls(decls, single_Decls(d)) : single_Decls(d);
+    } while (token > 0);
+    return program(line, decls);
+}
+
+Decl RDParser::parse_decl()
+{
+    switch (token) {
+    case VAR:  return parse_variableDecl();
+    case FUNC: return parse_callDecl();
+    default:   error(); return NULL;
+    }
+}
+
+//
+// variableDecl : VAR variable ';'
+//
+VariableDecl RDParser::parse_variableDecl()
+{
+    int line = token_line;
+    expect(VAR);
+    Variable v = parse_variable();
+    expect(';');
+    return variableDecl(line, v);
+}
+
+//
+// variable : OBJECTID TYPEID
+//
+Variable RDParser::parse_variable()
+{
+    int line = token_line;
+    Symbol name = token_val.symbol;
+    expect(OBJECTID);
+    Symbol type = token_val.symbol;
+    expect(TYPEID);
+    return variable(line, name, type);
+}
+
+//
+// callDecl : FUNC OBJECTID '(' variable_list ')' TYPEID stmtBlock
+//
+// variable_list, like actual_list, may be empty and may start with a
+// comma: "(, x Int)" is accepted by seal.y and so is accepted here.
+//
+CallDecl RDParser::parse_callDecl()
+{
+    int line = token_line;
+    int start = token_offset;
+    expect(FUNC);
+    Symbol name = token_val.symbol;
+    expect(OBJECTID);
+    expect('(');
+    Variables paras = nil_Variables();
+    if (token != ',' && token != ')')
+        paras = single_Variables(parse_variable());
+    while (token == ',') {
+        advance();
+        paras = append_Variables(paras, single_Variables(parse_variable()));
+    }
+    expect(')');
+    Symbol type = token_val.symbol;
+    expect(TYPEID);
+    if (text != NULL && token == '{') {
+        CallDecl decl = callDecl(line, name, paras, type, NULL);
+        if (skip_body(decl, start, line))
+            return decl;
+    }
+    StmtBlock body = parse_stmtBlock();
+    return callDecl(line, name, paras, type, body);
+}
+
+//
+// If a comment or a string constant starts at text[i], return the index of
+// its last character (len if it is not closed), adding the newlines in it
+// to lines; otherwise return i.  This is what the scanner skips without
+// looking for braces or keywords.  The newline ending a // comment is left
+// to the caller.
+//
+static int skip_comment_or_string(const char *text, int len, int i, int &lines)
+{
+    char c = text[i];
+    if (c == '/' && text[i + 1] == '/') {
+        while (i + 1 < len && text[i + 1] != '\n')
+            i++;
+    } else if (c == '/' && text[i + 1] == '*') {
+        for (i += 2; i + 1 < len && !(text[i] == '*' && text[i + 1] == '/'); i++)
+            if (text[i] == '\n')
+                lines++;
+        i++;
+    } else if (c == '"' || c == '`') {
+        for (i++; i < len && text[i] != c; i++) {
+            if (text[i] == '\n')
+                lines++;
+            else if (c == '"' && text[i] == '\\') {
+                if (text[i + 1] == '\n')
+                    lines++;
+                i++;
+            }
+        }
+    }
+    return i;
+}
+
+//
+// In outline mode, with the '{' of a function body as lookahead, find the
+// matching '}' and continue scanning after it, keeping curr_lineno right.
+// The declaration starts at offset decl_begin, on line decl_line.  Returns
+// false, leaving the body to be parsed now, if the braces do not match.
+//
+bool RDParser::skip_body(CallDecl decl, int decl_begin, int decl_line)
+{
+    int begin = token_offset;
+    int depth = 0, lines = 0, i;
+
+    for (i = begin; i < text_len; i++) {
+        char c = text[i];
+        if (c == '\n') {
+            lines++;
+        } else if (c == '{') {
+            depth++;
+        } else if (c == '}') {
+            if (--depth == 0)
+                break;
+        } else if (c == '/' || c == '"' || c == '`') {
+            i = skip_comment_or_string(text, text_len, i, lines);
+        }
+    }
+    if (i >= text_len)
+        return false;
+
+    LazyBody *b = new LazyBody;
+    b->ctx = ctx;
+    b->text = text;
+    b->len = text_len;
+    b->begin = begin;
+    b->end = i + 1;
+    b->line = token_line;
+    b->decl_begin = decl_begin;
+    b->decl_line = decl_line;
+    decl->setLazyBody(b);
+
+    // scan_text ends in two NULs, as yy_scan_buffer() wants
+    YY_BUFFER_STATE rest = yy_scan_buffer(scan_text + i + 1, text_len + 1 - i);
+    yy_delete_buffer(scan_buffer);
+    scan_buffer = rest;
+    curr_lineno = token_line + lines;
+    advance();
+    return true;
+}
+
+//
+// stmtBlock : '{' variableDecl_list stmt_list '}'   (either list optional)
+//
+StmtBlock RDParser::parse_stmtBlock()
+{
+    int line = token_line;
+    expect('{');
+    VariableDecls vars = NULL;
+    while (token == VAR) {
+        VariableDecl v = parse_variableDecl();
+        vars = vars ? append_VariableDecls(vars, single_VariableDecls(v))
+                    : single_VariableDecls(v);
+    }
+    Stmts stmts = NULL;
+    while (token != '}') {
+        Stmt s = parse_stmt();
+        stmts = stmts ? append_Stmts(stmts, single_Stmts(s)) : single_Stmts(s);
+    }
+    advance();
+    return stmtBlock(line, vars ? vars : nil_VariableDecls(),
+                     stmts ? stmts : nil_Stmts());
+}
+
+Stmt RDParser::parse_stmt()
+{
+    int line = token_line;
+    switch (token) {
+    case ';':
+        advance();
+        return no_expr(line);
+    case IF:
+        return parse_ifStmt();
+    case WHILE:
+        return parse_whileStmt();
+    case FOR:
+        return parse_forStmt();
+    case BREAK:
+        advance();
+        expect(';');
+        return breakstmt(line);
+    case CONTINUE:
+        advance();
+        expect(';');
+        return continuestmt(line);
+    case RETURN:
+        return parse_returnStmt();
+    case '{':
+        return parse_stmtBlock();
+    default: {
+        int loc;
+        Expr e = parse_expr(PREC_NONE, loc);
+        expect(';');
+        return e;
+    }
+    }
+}
+
+//
+// ifStmt : IF expr stmtBlock [ELSE stmtBlock]
+//
+Stmt RDParser::parse_ifStmt()
+{
+    int line = token_line, loc;
+    advance();
+    Expr cond = parse_expr(PREC_NONE, loc);
+    StmtBlock then_block = parse_stmtBlock();
+    if (token != ELSE)
+        return ifstmt(line, cond, then_block,
+                      stmtBlock(line, nil_VariableDecls(), nil_Stmts()));
+    advance();
+    return ifstmt(line, cond, then_block, parse_stmtBlock());
+}
+
+//
+// whileStmt : WHILE expr stmtBlock
+//
+Stmt RDParser::parse_whileStmt()
+{
+    int line = token_line, loc;
+    advance();
+    Expr cond = parse_expr(PREC_NONE, loc);
+    return whilestmt(line, cond, parse_stmtBlock());
+}
+
+//
+// forStmt : FOR [expr] ';' [expr] ';' [expr] stmtBlock
+//
+// A missing part becomes a no_expr on the line of FOR.
+//
+Stmt RDParser::parse_forStmt()
+{
+    int line = token_line, loc;
+    advance();
+    Expr init = token == ';' ? no_expr(line) : parse_expr(PREC_NONE, loc);
+    expect(';');
+    Expr cond = token == ';' ? no_expr(line) : parse_expr(PREC_NONE, loc);
+    expect(';');
+    Expr loop = token == '{' ? no_expr(line) : parse_expr(PREC_NONE, loc);
+    return forstmt(line, init, cond, loop, parse_stmtBlock());
+}
+
+//
+// returnStmt : RETURN [expr] ';'
+//
+Stmt RDParser::parse_returnStmt()
+{
+    int line = token_line, loc;
+    advance();
+    Expr value = token == ';' ? no_expr(line) : parse_expr(PREC_NONE, loc);
+    expect(';');
+    return returnstmt(line, value);
+}
+
+//
+// Parse an expression whose binary operators all bind tighter than
+// min_prec.  loc receives the line of its first token.
+//
+Expr RDParser::parse_expr(int min_prec, int &loc)
+{
+    Expr left = parse_prefix(loc);
+    int prec;
+    while ((prec = binary_prec(token)) > min_prec) {
+        int op = token, rloc;
+        advance();
+        Expr right = parse_expr(prec, rloc);
+        left = binary(op, loc, left, right);
+    }
+    return left;
+}
+
+//
+// Constants, identifiers, assignments, calls, parenthesized expressions
+// and the unary operators.  The operand of a unary operator takes every
+// binary operator that binds tighter than the operator itself, so
+// "!a & b" is "!(a & b)" but "~a & b" is "(~a) & b", as in seal.y.
+//
+Expr RDParser::parse_prefix(int &loc)
+{
+    int line = token_line, operand_loc;
+    YYSTYPE val = token_val;
+    loc = line;
+    Expr e;
+
+    switch (token) {
+    case CONST_BOOL:
+        advance();
+        return const_bool(line, val.boolean);
+    case CONST_INT:
+        advance();
+        return const_int(line, val.symbol);
+    case CONST_STRING:
+        advance();
+        return const_string(line, val.symbol);
+    case CONST_FLOAT:
+        advance();
+        return const_float(line, val.symbol);
+    case OBJECTID:
+        advance();
+        if (token == '=') {
+            // '=' has the lowest precedence: the right side takes the rest
+            advance();
+            return assign(line, val.symbol, parse_expr(PREC_NONE, operand_loc));
+        }
+        if (token == '(')
+            return parse_call(line, val.symbol);
+        return object(line, val.symbol);
+    case '(':
+        advance();
+        e = parse_expr(PREC_NONE, operand_loc);
+        expect(')');
+        return e;
+    case '-':
+        advance();
+        return neg(line, parse_expr(PREC_NEG, operand_loc));
+    case '!':
+        advance();
+        return not_(line, parse_expr(PREC_NOT, operand_loc));
+    case '~':
+        advance();
+        return bitnot(line, parse_expr(PREC_BIT, operand_loc));
+    default:
+        error();
+        return NULL;
+    }
+}
+
+//
+// call : OBJECTID '(' actual_list ')'
+//
+Expr RDParser::parse_call(int line, Symbol name)
+{
+    expect('(');
+    Actuals actuals = nil_Actuals();
+    if (token != ',' && token != ')')
+        actuals = single_Actuals(parse_actual());
+    while (token == ',') {
+        advance();
+        actuals = append_Actuals(actuals, single_Actuals(parse_actual()));
+    }
+    expect(')');
+    return call(line, name, actuals);
+}
+
+Actual RDParser::parse_actual()
+{
+    int loc;
+    Expr e = parse_expr(PREC_NONE, loc);
+    return actual(loc, e);
+}
+
+//
+// Parse source from offset from, on the given line, to its end, with
+// nothing skipped and nothing passed to the declaration handler, for the
+// syntax error it reports.
+//
+static void parse_rest(ParseContext *ctx, const char *source, int len,
+                       int from, int line)
+{
+    void (*handler)(Decl) = ctx->decl_handler;
+    ctx->decl_handler = NULL;
+    RDParser parser(ctx);
+    parser.parse_text(source + from, len - from, line);
+    ctx->decl_handler = handler;
+}
+
+//
+// Outline parse of len bytes of source.  source must stay valid as long as
+// the tree, since the bodies are parsed from it.
+//
+Program RDParser::parse_outline(const char *source, int len)
+{
+    text = source;
+    text_len = len;
+    scan_text = (char *) malloc(len + 2);
+    memcpy(scan_text, source, len);
+    scan_text[len] = scan_text[len + 1] = 0;
+    scan_buffer = scan_in_place(scan_text, len + 2);
+
+    Program p = NULL;
+    bool failed = false;
+    quiet = true;
+    try {
+        p = parse_program();
+    } catch (syntax_error &) {
+        failed = true;
+    }
+    end_scan();
+    free(scan_text);
+    if (failed)
+        parse_rest(ctx, source, len, 0, 1);
+    return p;
+}
+
+//
+// Parse a body the outline parser skipped.  On a syntax error the body is
+// left empty, and the error is that of parsing from its declaration on.
+//
+StmtBlock RDParser::parse_body(LazyBody *b)
+{
+    StmtBlock body;
+    bool failed = false;
+    scan_copy(b->text + b->begin, b->end - b->begin);
+    curr_lineno = b->line;
+    quiet = true;
+    try {
+        advance();
+        body = parse_stmtBlock();
+        if (token > 0)
+            error();
+    } catch (syntax_error &) {
+        body = stmtBlock(b->line, nil_VariableDecls(), nil_Stmts());
+        failed = true;
+    }
+    end_scan();
+    if (failed) {
+        int errors = ctx->omerrs;
+        parse_rest(ctx, b->text, b->len, b->decl_begin, b->decl_line);
+        // the braces may have hidden the error from the full parse too
+        if (ctx->omerrs == errors) {
+            seal_yyerror(&token_line, ctx, "syntax error");
+        }
+    }
+    return body;
+}
+
+//
+// Parse len bytes of source held in memory, as seal_rdparse() parses fin,
+// numbering lines from line.
+//
+Program RDParser::parse_text(const char *source, int len, int line)
+{
+    Program p = NULL;
+    scan_copy(source, len);
+    curr_lineno = line;
+    try {
+        p = parse_program();
+    } catch (syntax_error &) {
+    }
+    end_scan();
+    return p;
+}
+
+//
+// Parse a region holding one declaration, starting at the given line.
+// Returns NULL, without reporting anything, if it does not parse.
+//
+Decl RDParser::parse_region(const char *source, int len, int line)
+{
+    Decl d = NULL;
+    scan_copy(source, len);
+    quiet = true;
+    curr_lineno = line;
+    try {
+        advance();
+        d = parse_decl();
+        if (token > 0)
+            error();
+    } catch (syntax_error &) {
+        d = NULL;
+    }
+    end_scan();
+    return d;
+}
+
+//
+// FNV-1a, to key the regions of the source
+//
+static unsigned long long hash_text(const char *text, int len)
+{
+    unsigned long long h = 14695981039346656037ULL;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char) text[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+//
+// The length of old region j, in the text it was cut from
+//
+static int old_region_len(const std::vector<ReparseCache::Region> &prev, size_t j,
+                          int old_len)
+{
+    return (j + 1 < prev.size() ? prev[j + 1].start : old_len) - prev[j].start;
+}
+
+//
+// Split text into declaration regions, starting at from, which is the
+// start of a region on the given line.  The offset and line of each region
+// go to starts and lines; the first region also takes whatever comes before
+// its declaration.  Cutting stops at a boundary that is one of the sorted
+// offsets in sync, whose index is returned, or else at the end of text,
+// and -1 is returned.  Either way the offset where the last region ends is
+// pushed on starts, and on a boundary in sync its line on lines.
+//
+static int split_decls(const char *text, int len, int from, int line,
+                       const std::vector<int> &sync,
+                       std::vector<int> &starts, std::vector<int> &lines)
+{
+    int depth = 0;
+    bool first = true;
+    size_t s = 0;
+
+    starts.push_back(from);
+    lines.push_back(line);
+    for (int i = from; i < len; i++) {
+        char c = text[i];
+        if (c == '\n') {
+            line++;
+        } else if (c == '{') {
+            depth++;
+        } else if (c == '}') {
+            depth--;
+        } else if (isalnum(c) || c == '_') {
+            int j = i;
+            while (j < len && (isalnum(text[j]) || text[j] == '_'))
+                j++;
+            if (depth == 0 &&
+                ((j - i == 4 && strncmp(text + i, "func", 4) == 0) ||
+                 (j - i == 3 && strncmp(text + i, "var", 3) == 0))) {
+                if (!first) {
+                    starts.push_back(i);
+                    lines.push_back(line);
+                    while (s < sync.size() && sync[s] < i)
+                        s++;
+                    if (s < sync.size() && sync[s] == i)
+                        return s;
+                }
+                first = false;
+            }
+            i = j - 1;
+        } else if (c == '/' || c == '"' || c == '`') {
+            i = skip_comment_or_string(text, len, i, line);
+        }
+    }
+    starts.push_back(len);
+    return -1;
+}
+
+//
+// The lengths of the common head and tail of a and b, comparing blocks
+// with memcmp() before single characters.
+//
+static int common_prefix(const char *a, const char *b, int len)
+{
+    int n = 0;
+    while (n + 4096 <= len && memcmp(a + n, b + n, 4096) == 0)
+        n += 4096;
+    while (n < len && a[n] == b[n])
+        n++;
+    return n;
+}
+
+static int common_suffix(const char *a, const char *b, int len)
+{
+    int n = 0;
+    while (n + 4096 <= len && memcmp(a - n - 4096, b - n - 4096, 4096) == 0)
+        n += 4096;
+    while (n < len && a[-n - 1] == b[-n - 1])
+        n++;
+    return n;
+}
+
+//
+// Entry points.  seal_rdparse(ctx) is a drop-in replacement for
+// seal_yyparse(ctx).
+//
+int seal_rdparse(ParseContext *ctx)
+{
+    RDParser parser(ctx);
+    try {
+        ctx->ast_root = parser.parse_program();
+    } catch (syntax_error &) {
+        return 1;
+    }
+    return 0;
+}
+
+//
+// Read all of f into memory; the text is NUL-terminated.
+//
+char *read_source(FILE *f, int *len)
+{
+    int size = 1 << 16, n;
+    char *source = (char *) malloc(size);
+    *len = 0;
+    while ((n = fread(source + *len, 1, size - *len, f)) > 0) {
+        *len += n;
+        if (*len == size)
+            source = (char *) realloc(source, size *= 2);
+    }
+    source[*len] = 0;
+    return source;
+}
+
+int seal_outline_parse(ParseContext *ctx, FILE *f)
+{
+    int len;
+    char *source = read_source(f, &len);
+    RDParser parser(ctx);
+    ctx->ast_root = parser.parse_outline(source, len);
+    return ctx->ast_root == NULL;
+}
+
+//
+// Parse len bytes of source, reusing what cache holds of the previous call,
+// and leave this parse in cache.  Reused trees are moved, not copied, so
+// the tree of the previous call must no longer be used.  If some region
+// does not parse on its own the whole text is parsed instead, so that
+// errors are reported just as seal_rdparse() reports them, and the cache
+// is emptied.
+//
+// A region of the head is kept only if the "func" or "var" that ends it,
+// and the character after that, are also unchanged.
+//
+int seal_reparse(ParseContext *ctx, ReparseCache *cache, const char *source, int len)
+{
+    std::vector<ReparseCache::Region> &prev = cache->regions;
+    std::vector<ReparseCache::Region> next;
+    const char *old = cache->text.data();
+    int old_len = cache->text.size();
+    int shorter = old_len < len ? old_len : len;
+    int head = common_prefix(old, source, shorter);
+    int tail = common_suffix(old + old_len, source + len, shorter - head);
+    size_t kept = 0, first_tail;
+
+    while (kept + 1 < prev.size() && prev[kept + 1].start + 5 <= head)
+        kept++;
+    for (first_tail = kept + 1; first_tail < prev.size(); first_tail++)
+        if (prev[first_tail].start >= old_len - tail)
+            break;
+
+    // the old regions of the tail, where they would now start
+    std::vector<int> sync;
+    for (size_t j = first_tail; j < prev.size(); j++)
+        sync.push_back(prev[j].start + len - old_len);
+
+    std::vector<int> starts, lines;
+    int s = prev.empty() ? split_decls(source, len, 0, 1, sync, starts, lines)
+                         : split_decls(source, len, prev[kept].start,
+                                       prev[kept].line, sync, starts, lines);
+
+    // the old regions that were cut again, by the hash of their text
+    std::map<unsigned long long, size_t> cut;
+    size_t end_cut = s < 0 ? prev.size() : first_tail + s;
+    for (size_t j = kept; j < end_cut; j++)
+        cut[prev[j].hash] = j;
+
+    cache->reused = prev.empty() ? 0 : kept;
+    cache->parsed = 0;
+    next.assign(prev.begin(), prev.begin() + (prev.empty() ? 0 : kept));
+
+    size_t k;
+    for (k = 0; k + 1 < starts.size(); k++) {
+        ReparseCache::Region r;
+        int region_len = starts[k + 1] - starts[k];
+        std::map<unsigned long long, size_t>::iterator e;
+
+        r.start = starts[k];
+        r.line = lines[k];
+        r.hash = hash_text(source + r.start, region_len);
+        // a hash can collide: reuse only a region whose bytes are the same
+        if ((e = cut.find(r.hash)) != cut.end() &&
+            old_region_len(prev, e->second, old_len) == region_len &&
+            memcmp(old + prev[e->second].start, source + r.start, region_len) == 0) {
+            r.decl = prev[e->second].decl;
+            if (r.line != prev[e->second].line)
+                r.decl->shift_lines(r.line - prev[e->second].line);
+            cut.erase(e);
+            cache->reused++;
+        } else {
+            RDParser parser(ctx);
+            r.decl = parser.parse_region(source + r.start, region_len, r.line);
+            if (r.decl == NULL)
+                break;
+            cache->parsed++;
+        }
+        next.push_back(r);
+    }
+
+    if (k + 1 < starts.size()) {
+        cache->reused = 0;
+        cache->parsed = next.size() - k + starts.size() - 1 +
+                        (s < 0 ? 0 : prev.size() - end_cut);
+        prev.clear();
+        cache->text.clear();
+        RDParser parser(ctx);
+        ctx->ast_root = parser.parse_text(source, len);
+        return ctx->ast_root == NULL;
+    }
+
+    if (s >= 0) {
+        int delta = lines.back() - prev[end_cut].line;
+        for (size_t j = end_cut; j < prev.size(); j++) {
+            ReparseCache::Region r = prev[j];
+            r.start += len - old_len;
+            if (delta != 0) {
+                r.line += delta;
+                r.decl->shift_lines(delta);
+            }
+            next.push_back(r);
+            cache->reused++;
+        }
+    }
+
+    Decls decls = NULL;
+    for (k = 0; k < next.size(); k++)
+        decls = decls ? append_Decls(decls, single_Decls(next[k].decl))
+                      : single_Decls(next[k].decl);
+    ctx->ast_root = program(next[0].decl->get_line_number(), decls);
+    prev.swap(next);
+    cache->text.assign(source, len);
+    return 0;
+}
+
+StmtBlock parse_lazy_body(LazyBody *b)
+{
+    int saved_lineno = curr_lineno;
+    YYSTYPE saved_lval = seal_yylval;
+    RDParser parser(b->ctx);
+    StmtBlock body = parser.parse_body(b);
+    curr_lineno = saved_lineno;
+    seal_yylval = saved_lval;
+    return body;
+}
@@ -0,0 +1,2300 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         semant_yyparse
+#define yylex           semant_yylex
+#define yyerror         semant_yyerror
+#define yydebug         semant_yydebug
+#define yynerrs         semant_yynerrs
+
+/* First part of user prologue.  */
+#line 8 "seal-semant.y"
+
+  #include <iostream>
+  #include "seal-decl.h"
+  #include "seal-stmt.h"
+  #include "seal-expr.h"
+  #include "stringtab.h"
+  #include "utilities.h"
+  #include "parse_context.h"
+
+  /* Locations */
+  #define YYLTYPE int              /* the type of locations */
+
+      #define YYLLOC_DEFAULT(Current, Rhs, N)         \
+      Current = Rhs[1];
+
+    /* IMPORTANT NOTE ON LINE NUMBERS
+    *********************************
+    * The above definitions cause every terminal in the grammar to have the
+    * line number supplied by the lexer, and every non-terminal to have the
+    * line number of its first symbol.  Every AST constructor takes the line
+    * number of the node as its first argument, so an action passes @$ (or
+    * any @i it prefers) explicitly:
+
+    add_consts	: INT_CONST '+' INT_CONST
+    {
+      $$ = add(@$, const_int(@1, $1), const_int(@3, $3));
+    }
+
+    * No global is involved, which keeps the parser reentrant.
+    */
+    
+
+#line 109 "seal-semant.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "seal-semant.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IF = 3,                         /* IF  */
+  YYSYMBOL_ELSE = 4,                       /* ELSE  */
+  YYSYMBOL_WHILE = 5,                      /* WHILE  */
+  YYSYMBOL_FOR = 6,                        /* FOR  */
+  YYSYMBOL_BREAK = 7,                      /* BREAK  */
+  YYSYMBOL_CONTINUE = 8,                   /* CONTINUE  */
+  YYSYMBOL_FUNC = 9,                       /* FUNC  */
+  YYSYMBOL_RETURN = 10,                    /* RETURN  */
+  YYSYMBOL_VAR = 11,                       /* VAR  */
+  YYSYMBOL_AND = 12,                       /* AND  */
+  YYSYMBOL_OR = 13,                        /* OR  */
+  YYSYMBOL_EQUAL = 14,                     /* EQUAL  */
+  YYSYMBOL_NE = 15,                        /* NE  */
+  YYSYMBOL_GE = 16,                        /* GE  */
+  YYSYMBOL_LE = 17,                        /* LE  */
+  YYSYMBOL_CONST_BOOL = 18,                /* CONST_BOOL  */
+  YYSYMBOL_CONST_INT = 19,                 /* CONST_INT  */
+  YYSYMBOL_CONST_STRING = 20,              /* CONST_STRING  */
+  YYSYMBOL_CONST_FLOAT = 21,               /* CONST_FLOAT  */
+  YYSYMBOL_OBJECTID = 22,                  /* OBJECTID  */
+  YYSYMBOL_TYPEID = 23,                    /* TYPEID  */
+  YYSYMBOL_UMINUS = 24,                    /* UMINUS  */
+  YYSYMBOL_25_ = 25,                       /* '='  */
+  YYSYMBOL_26_ = 26,                       /* '<'  */
+  YYSYMBOL_27_ = 27,                       /* '>'  */
+  YYSYMBOL_28_ = 28,                       /* '+'  */
+  YYSYMBOL_29_ = 29,                       /* '-'  */
+  YYSYMBOL_30_ = 30,                       /* '*'  */
+  YYSYMBOL_31_ = 31,                       /* '/'  */
+  YYSYMBOL_32_ = 32,                       /* '%'  */
+  YYSYMBOL_33_ = 33,                       /* '!'  */
+  YYSYMBOL_34_ = 34,                       /* '&'  */
+  YYSYMBOL_35_ = 35,                       /* '|'  */
+  YYSYMBOL_36_ = 36,                       /* '^'  */
+  YYSYMBOL_37_ = 37,                       /* '~'  */
+  YYSYMBOL_38_ = 38,                       /* ';'  */
+  YYSYMBOL_39_ = 39,                       /* ','  */
+  YYSYMBOL_40_ = 40,                       /* '('  */
+  YYSYMBOL_41_ = 41,                       /* ')'  */
+  YYSYMBOL_42_ = 42,                       /* '{'  */
+  YYSYMBOL_43_ = 43,                       /* '}'  */
+  YYSYMBOL_YYACCEPT = 44,                  /* $accept  */
+  YYSYMBOL_program = 45,                   /* program  */
+  YYSYMBOL_decl = 46,                      /* decl  */
+  YYSYMBOL_decl_list = 47,                 /* decl_list  */
+  YYSYMBOL_variableDecl = 48,              /* variableDecl  */
+  YYSYMBOL_variableDecl_list = 49,         /* variableDecl_list  */
+  YYSYMBOL_variable = 50,                  /* variable  */
+  YYSYMBOL_variable_list = 51,             /* variable_list  */
+  YYSYMBOL_callDecl = 52,                  /* callDecl  */
+  YYSYMBOL_stmtBlock = 53,                 /* stmtBlock  */
+  YYSYMBOL_stmt = 54,                      /* stmt  */
+  YYSYMBOL_stmt_list = 55,                 /* stmt_list  */
+  YYSYMBOL_ifStmt = 56,                    /* ifStmt  */
+  YYSYMBOL_whileStmt = 57,                 /* whileStmt  */
+  YYSYMBOL_forStmt = 58,                   /* forStmt  */
+  YYSYMBOL_breakStmt = 59,                 /* breakStmt  */
+  YYSYMBOL_continueStmt = 60,              /* continueStmt  */
+  YYSYMBOL_returnStmt = 61,                /* returnStmt  */
+  YYSYMBOL_expr = 62,                      /* expr  */
+  YYSYMBOL_call = 63,                      /* call  */
+  YYSYMBOL_actual = 64,                    /* actual  */
+  YYSYMBOL_actual_list = 65                /* actual_list  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+/* Unqualified %code blocks.  */
+#line 45 "seal-semant.y"
+
+      /*
+       * The scanner is shared with seal.y, which defines seal_yylval and
+       * curr_lineno; this adapter hands them to the pure parser.
+       */
+      extern thread_local YYSTYPE seal_yylval;
+      int seal_yylex();
+
+      static int semant_yylex(YYSTYPE *lvalp, YYLTYPE *llocp, ParseContext *ctx)
+      {
+        int token = seal_yylex();
+        *lvalp = seal_yylval;
+        *llocp = curr_lineno;
+        ctx->last_token = token;
+        return token;
+      }
+
+      /* defined below; called for each parse error */
+      void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s);
+    
+
+#line 231 "seal-semant.tab.c"
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  10
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   573
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  44
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  22
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  76
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  141
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   287
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    33,     2,     2,     2,    32,    34,     2,
+      40,    41,    30,    28,    39,    29,     2,    31,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    38,
+      26,    25,    27,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    36,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    42,    35,    43,    37,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     2,
+       4,     5,     6,     7,     8,     9,    10,    18,    19,    20,
+      21,    11,     2,     2,    12,    13,    14,    15,    16,    17,
+       2,     2,     2,     2,    22,    23,     2,    24
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   161,   161,   168,   171,   177,   180,   186,   192,   195,
+     201,   207,   210,   216,   219,   225,   228,   231,   234,   240,
+     243,   246,   249,   252,   255,   258,   261,   264,   270,   273,
+     279,   282,   288,   294,   297,   300,   303,   306,   309,   312,
+     315,   321,   327,   333,   336,   342,   345,   348,   351,   354,
+     357,   360,   363,   366,   369,   372,   375,   378,   381,   384,
+     387,   390,   393,   396,   399,   402,   405,   408,   411,   414,
+     417,   420,   426,   429,   435,   441,   444
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IF", "ELSE", "WHILE",
+  "FOR", "BREAK", "CONTINUE", "FUNC", "RETURN", "VAR", "AND", "OR",
+  "EQUAL", "NE", "GE", "LE", "CONST_BOOL", "CONST_INT", "CONST_STRING",
+  "CONST_FLOAT", "OBJECTID", "TYPEID", "UMINUS", "'='", "'<'", "'>'",
+  "'+'", "'-'", "'*'", "'/'", "'%'", "'!'", "'&'", "'|'", "'^'", "'~'",
+  "';'", "','", "'('", "')'", "'{'", "'}'", "$accept", "program", "decl",
+  "decl_list", "variableDecl", "variableDecl_list", "variable",
+  "variable_list", "callDecl", "stmtBlock", "stmt", "stmt_list", "ifStmt",
+  "whileStmt", "forStmt", "breakStmt", "continueStmt", "returnStmt",
+  "expr", "call", "actual", "actual_list", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-44)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+      -2,     9,    24,   -44,    -2,   -44,   -13,   -44,    19,   -44,
+     -44,   -44,   -44,    12,     3,    26,    -5,   -44,    30,   119,
+     -44,    47,    -5,   155,   155,   195,    44,    45,   236,   -44,
+     -44,   -44,   -44,   -20,   155,   155,   155,   -44,   155,   -44,
+     -44,   160,   -44,   -44,   201,   -44,   -44,   -44,   -44,   -44,
+     -44,   335,   -44,   -44,   -44,   274,   274,   512,   362,   -44,
+     -44,   -44,   389,   155,   114,    -1,    -1,   -44,   305,   -44,
+     -44,   242,   -44,   -44,   155,   155,   155,   155,   155,   155,
+     155,   155,   155,   155,   155,   155,   155,   155,   155,   155,
+     -44,    80,   -44,   -10,   416,   518,   -44,   470,   -44,   470,
+     -44,    34,   -44,   -44,    64,   470,   493,   493,   537,   537,
+     537,   537,    15,    15,    -1,    -1,    -1,   -44,   -44,   -44,
+      -5,   -44,   274,   -10,   -10,   443,   155,   -44,   -44,   -44,
+     -44,   274,   -44,   274,   -10,   -44,   -44,   -44,   -44,   274,
+     -44
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     5,     2,     3,     0,     4,     0,    10,
+       1,     6,     7,     0,     0,     0,     0,    11,     0,     0,
+      14,     0,     0,     0,     0,     0,     0,     0,     0,    49,
+      46,    47,    48,    50,     0,     0,     0,    19,     0,    18,
+       8,     0,    27,    28,     0,    21,    22,    23,    24,    25,
+      26,     0,    51,    12,    13,     0,     0,     0,     0,    41,
+      42,    44,     0,     0,     0,    58,    67,    68,     0,    17,
+       9,     0,    16,    29,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      20,    30,    32,     0,     0,     0,    43,    45,    73,    74,
+      75,     0,    52,    15,    65,    66,    61,    62,    63,    60,
+      59,    64,    53,    54,    55,    56,    57,    69,    70,    71,
+       0,    40,     0,     0,     0,     0,     0,    72,    31,    37,
+      38,     0,    39,     0,     0,    76,    34,    35,    36,     0,
+      33
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -44,   -44,    81,   -44,    -3,   -44,     8,   -44,   -44,   -16,
+     -43,    46,   -44,   -44,   -44,   -44,   -44,   -44,   -21,   -44,
+     -40,   -44
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     2,     3,     4,     5,    41,     6,    18,     7,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+     100,   101
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      20,    73,    55,    56,    58,    63,    54,    62,    29,    30,
+      31,    32,    33,    65,    66,    67,    40,    68,     8,    34,
+      64,     1,    17,    35,    10,    12,    15,    36,    73,    53,
+      38,     9,    19,    87,    88,    89,    94,    19,    70,    91,
+      92,    13,    97,    99,    16,    84,    85,    86,     9,    87,
+      88,    89,    14,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,    21,
+      15,    22,   122,   126,   125,   127,    74,   121,    76,    77,
+      78,    79,    59,    60,   120,    11,   135,    71,     0,     0,
+      80,    81,    82,    83,    84,    85,    86,     0,    87,    88,
+      89,     0,   131,   133,   128,    99,   129,   130,   132,     0,
+       0,     0,     0,   139,     0,   136,     0,   137,   138,     0,
+       0,     0,    23,   140,    24,    25,    26,    27,     0,    28,
+       0,     0,    29,    30,    31,    32,    33,    29,    30,    31,
+      32,    33,    15,    34,     0,     0,     0,    35,    34,     0,
+       0,    36,    35,     0,    38,    98,    36,    37,     0,    38,
+       0,    19,    39,    23,     0,    24,    25,    26,    27,     0,
+      28,     0,     0,    29,    30,    31,    32,    33,    29,    30,
+      31,    32,    33,    15,    34,     0,     0,     0,    35,    34,
+       0,     0,    36,    35,     0,    38,     0,    36,    37,     0,
+      38,     0,    19,    69,    23,     0,    24,    25,    26,    27,
+       0,    28,     0,    29,    30,    31,    32,    33,     0,    29,
+      30,    31,    32,    33,    34,     0,     0,     0,    35,     0,
+      34,     0,    36,    57,    35,    38,     0,     0,    36,    37,
+       0,    38,     0,    19,    72,    23,     0,    24,    25,    26,
+      27,     0,    28,     0,    29,    30,    31,    32,    33,     0,
+      29,    30,    31,    32,    33,    34,     0,     0,     0,    35,
+       0,    34,     0,    36,    61,    35,    38,     0,     0,    36,
+      37,     0,    38,     0,    19,   103,    74,    75,    76,    77,
+      78,    79,     0,     0,     0,     0,     0,     0,     0,     0,
+      80,    81,    82,    83,    84,    85,    86,     0,    87,    88,
+      89,     0,     0,     0,     0,     0,    19,    74,    75,    76,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,     0,
+       0,    80,    81,    82,    83,    84,    85,    86,     0,    87,
+      88,    89,     0,     0,     0,     0,   102,    74,    75,    76,
+      77,    78,    79,     0,     0,     0,     0,     0,     0,     0,
+       0,    80,    81,    82,    83,    84,    85,    86,     0,    87,
+      88,    89,     0,    90,    74,    75,    76,    77,    78,    79,
+       0,     0,     0,     0,     0,     0,     0,     0,    80,    81,
+      82,    83,    84,    85,    86,     0,    87,    88,    89,     0,
+      95,    74,    75,    76,    77,    78,    79,     0,     0,     0,
+       0,     0,     0,     0,     0,    80,    81,    82,    83,    84,
+      85,    86,     0,    87,    88,    89,     0,    96,    74,    75,
+      76,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+       0,     0,    80,    81,    82,    83,    84,    85,    86,     0,
+      87,    88,    89,     0,   123,    74,    75,    76,    77,    78,
+      79,     0,     0,     0,     0,     0,     0,     0,     0,    80,
+      81,    82,    83,    84,    85,    86,     0,    87,    88,    89,
+       0,   134,    74,    75,    76,    77,    78,    79,     0,     0,
+       0,     0,     0,     0,     0,     0,    80,    81,    82,    83,
+      84,    85,    86,     0,    87,    88,    89,    -1,    -1,    78,
+      79,     0,     0,     0,     0,     0,     0,     0,     0,    80,
+      81,    82,    83,    84,    85,    86,     0,    87,    88,    89,
+      29,    30,    31,    32,    33,     0,    29,    30,    31,    32,
+      33,    34,     0,     0,     0,    35,     0,    34,     0,    36,
+      93,    35,    38,    -1,    -1,    36,   124,     0,    38,     0,
+       0,     0,     0,    -1,    -1,    82,    83,    84,    85,    86,
+       0,    87,    88,    89
+};
+
+static const yytype_int16 yycheck[] =
+{
+      16,    44,    23,    24,    25,    25,    22,    28,    18,    19,
+      20,    21,    22,    34,    35,    36,    19,    38,     9,    29,
+      40,    23,    14,    33,     0,    38,    23,    37,    71,    21,
+      40,    22,    42,    34,    35,    36,    57,    42,    41,    55,
+      56,    22,    63,    64,    41,    30,    31,    32,    22,    34,
+      35,    36,    40,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    39,
+      23,    41,    93,    39,    95,    41,    12,    93,    14,    15,
+      16,    17,    38,    38,     4,     4,   126,    41,    -1,    -1,
+      26,    27,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    -1,   123,   124,   120,   126,   122,   123,   124,    -1,
+      -1,    -1,    -1,   134,    -1,   131,    -1,   133,   134,    -1,
+      -1,    -1,     3,   139,     5,     6,     7,     8,    -1,    10,
+      -1,    -1,    18,    19,    20,    21,    22,    18,    19,    20,
+      21,    22,    23,    29,    -1,    -1,    -1,    33,    29,    -1,
+      -1,    37,    33,    -1,    40,    41,    37,    38,    -1,    40,
+      -1,    42,    43,     3,    -1,     5,     6,     7,     8,    -1,
+      10,    -1,    -1,    18,    19,    20,    21,    22,    18,    19,
+      20,    21,    22,    23,    29,    -1,    -1,    -1,    33,    29,
+      -1,    -1,    37,    33,    -1,    40,    -1,    37,    38,    -1,
+      40,    -1,    42,    43,     3,    -1,     5,     6,     7,     8,
+      -1,    10,    -1,    18,    19,    20,    21,    22,    -1,    18,
+      19,    20,    21,    22,    29,    -1,    -1,    -1,    33,    -1,
+      29,    -1,    37,    38,    33,    40,    -1,    -1,    37,    38,
+      -1,    40,    -1,    42,    43,     3,    -1,     5,     6,     7,
+       8,    -1,    10,    -1,    18,    19,    20,    21,    22,    -1,
+      18,    19,    20,    21,    22,    29,    -1,    -1,    -1,    33,
+      -1,    29,    -1,    37,    38,    33,    40,    -1,    -1,    37,
+      38,    -1,    40,    -1,    42,    43,    12,    13,    14,    15,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      26,    27,    28,    29,    30,    31,    32,    -1,    34,    35,
+      36,    -1,    -1,    -1,    -1,    -1,    42,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    26,    27,    28,    29,    30,    31,    32,    -1,    34,
+      35,    36,    -1,    -1,    -1,    -1,    41,    12,    13,    14,
+      15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    26,    27,    28,    29,    30,    31,    32,    -1,    34,
+      35,    36,    -1,    38,    12,    13,    14,    15,    16,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,    27,
+      28,    29,    30,    31,    32,    -1,    34,    35,    36,    -1,
+      38,    12,    13,    14,    15,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    26,    27,    28,    29,    30,
+      31,    32,    -1,    34,    35,    36,    -1,    38,    12,    13,
+      14,    15,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    26,    27,    28,    29,    30,    31,    32,    -1,
+      34,    35,    36,    -1,    38,    12,    13,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
+      27,    28,    29,    30,    31,    32,    -1,    34,    35,    36,
+      -1,    38,    12,    13,    14,    15,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    26,    27,    28,    29,
+      30,    31,    32,    -1,    34,    35,    36,    14,    15,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
+      27,    28,    29,    30,    31,    32,    -1,    34,    35,    36,
+      18,    19,    20,    21,    22,    -1,    18,    19,    20,    21,
+      22,    29,    -1,    -1,    -1,    33,    -1,    29,    -1,    37,
+      38,    33,    40,    16,    17,    37,    38,    -1,    40,    -1,
+      -1,    -1,    -1,    26,    27,    28,    29,    30,    31,    32,
+      -1,    34,    35,    36
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    23,    45,    46,    47,    48,    50,    52,     9,    22,
+       0,    46,    38,    22,    40,    23,    41,    50,    51,    42,
+      53,    39,    41,     3,     5,     6,     7,     8,    10,    18,
+      19,    20,    21,    22,    29,    33,    37,    38,    40,    43,
+      48,    49,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    50,    53,    62,    62,    38,    62,    38,
+      38,    38,    62,    25,    40,    62,    62,    62,    62,    43,
+      48,    55,    43,    54,    12,    13,    14,    15,    16,    17,
+      26,    27,    28,    29,    30,    31,    32,    34,    35,    36,
+      38,    53,    53,    38,    62,    38,    38,    62,    41,    62,
+      64,    65,    41,    43,    62,    62,    62,    62,    62,    62,
+      62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
+       4,    53,    62,    38,    38,    62,    39,    41,    53,    53,
+      53,    62,    53,    62,    38,    64,    53,    53,    53,    62,
+      53
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    44,    45,    46,    46,    47,    47,    48,    49,    49,
+      50,    51,    51,    52,    52,    53,    53,    53,    53,    54,
+      54,    54,    54,    54,    54,    54,    54,    54,    55,    55,
+      56,    56,    57,    58,    58,    58,    58,    58,    58,    58,
+      58,    59,    60,    61,    61,    62,    62,    62,    62,    62,
+      62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
+      62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
+      62,    62,    63,    63,    64,    65,    65
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     1,     2,     2,     1,     2,
+       2,     1,     3,     7,     6,     4,     3,     3,     2,     1,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       3,     5,     3,     7,     6,     6,     6,     5,     5,     5,
+       4,     2,     2,     3,     2,     3,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     3,     3,     3,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     2,     3,
+       3,     3,     4,     3,     1,     1,     3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, ctx, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, ctx); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ParseContext *ctx)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (ctx);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, ParseContext *ctx)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, ctx);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, ParseContext *ctx)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), ctx);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, ctx); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, ParseContext *ctx)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (ctx);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (ParseContext *ctx)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, ctx);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: decl_list  */
+#line 161 "seal-semant.y"
+                        {
+      (yyloc) = (yylsp[0]);
+      ctx->ast_root = program((yyloc), (yyvsp[0].decls));
+    }
+#line 1492 "seal-semant.tab.c"
+    break;
+
+  case 3: /* decl: variableDecl  */
+#line 168 "seal-semant.y"
+                         {
+      (yyval.decl) = (yyvsp[0].variableDecl);
+    }
+#line 1500 "seal-semant.tab.c"
+    break;
+
+  case 4: /* decl: callDecl  */
+#line 171 "seal-semant.y"
+               {
+      (yyval.decl) = (yyvsp[0].callDecl);
+    }
+#line 1508 "seal-semant.tab.c"
+    break;
+
+  case 5: /* decl_list: decl  */
+#line 177 "seal-semant.y"
+                     {
+      (yyval.decls) = single_Decls((yyvsp[0].decl));
+    }
+#line 1516 "seal-semant.tab.c"
+    break;
+
+  case 6: /* decl_list: decl_list decl  */
+#line 180 "seal-semant.y"
+                     {
+      (yyval.decls) = append_Decls((yyvsp[-1].decls), single_Decls((yyvsp[0].decl)));
+    }
+#line 1524 "seal-semant.tab.c"
+    break;
+
+  case 7: /* variableDecl: variable ';'  */
+#line 186 "seal-semant.y"
+                                 {
+      (yyval.variableDecl) = variableDecl((yyloc), (yyvsp[-1].variable));
+    }
+#line 1532 "seal-semant.tab.c"
+    break;
+
+  case 8: /* variableDecl_list: variableDecl  */
+#line 192 "seal-semant.y"
+                                     {
+      (yyval.variableDecls) = single_VariableDecls((yyvsp[0].variableDecl));
+    }
+#line 1540 "seal-semant.tab.c"
+    break;
+
+  case 9: /* variableDecl_list: variableDecl_list variableDecl  */
+#line 195 "seal-semant.y"
+                                     {
+      (yyval.variableDecls) = append_VariableDecls((yyvsp[-1].variableDecls), single_VariableDecls((yyvsp[0].variableDecl)));
+    }
+#line 1548 "seal-semant.tab.c"
+    break;
+
+  case 10: /* variable: TYPEID OBJECTID  */
+#line 201 "seal-semant.y"
+                                {
+      (yyval.variable) = variable((yyloc), (yyvsp[0].symbol), (yyvsp[-1].symbol));
+    }
+#line 1556 "seal-semant.tab.c"
+    break;
+
+  case 11: /* variable_list: variable  */
+#line 207 "seal-semant.y"
+                             {
+      (yyval.variables) = single_Variables((yyvsp[0].variable));
+    }
+#line 1564 "seal-semant.tab.c"
+    break;
+
+  case 12: /* variable_list: variable_list ',' variable  */
+#line 210 "seal-semant.y"
+                                 {
+      (yyval.variables) = append_Variables((yyvsp[-2].variables), single_Variables((yyvsp[0].variable)));
+    }
+#line 1572 "seal-semant.tab.c"
+    break;
+
+  case 13: /* callDecl: TYPEID FUNC OBJECTID '(' variable_list ')' stmtBlock  */
+#line 216 "seal-semant.y"
+                                                                     {
+      (yyval.callDecl) = callDecl((yyloc), (yyvsp[-4].symbol), (yyvsp[-2].variables), (yyvsp[-6].symbol), (yyvsp[0].stmtBlock));
+    }
+#line 1580 "seal-semant.tab.c"
+    break;
+
+  case 14: /* callDecl: TYPEID FUNC OBJECTID '(' ')' stmtBlock  */
+#line 219 "seal-semant.y"
+                                             {
+      (yyval.callDecl) = callDecl((yyloc), (yyvsp[-3].symbol), nil_Variables(), (yyvsp[-5].symbol), (yyvsp[0].stmtBlock));
+    }
+#line 1588 "seal-semant.tab.c"
+    break;
+
+  case 15: /* stmtBlock: '{' variableDecl_list stmt_list '}'  */
+#line 225 "seal-semant.y"
+                                                    {
+      (yyval.stmtBlock) = stmtBlock((yyloc), (yyvsp[-2].variableDecls), (yyvsp[-1].stmts));
+    }
+#line 1596 "seal-semant.tab.c"
+    break;
+
+  case 16: /* stmtBlock: '{' stmt_list '}'  */
+#line 228 "seal-semant.y"
+                        {
+      (yyval.stmtBlock) = stmtBlock((yyloc), nil_VariableDecls(), (yyvsp[-1].stmts));
+    }
+#line 1604 "seal-semant.tab.c"
+    break;
+
+  case 17: /* stmtBlock: '{' variableDecl_list '}'  */
+#line 231 "seal-semant.y"
+                                {
+      (yyval.stmtBlock) = stmtBlock((yyloc), (yyvsp[-1].variableDecls), nil_Stmts());
+    }
+#line 1612 "seal-semant.tab.c"
+    break;
+
+  case 18: /* stmtBlock: '{' '}'  */
+#line 234 "seal-semant.y"
+              {
+      (yyval.stmtBlock) = stmtBlock((yyloc), nil_VariableDecls(), nil_Stmts());
+    }
+#line 1620 "seal-semant.tab.c"
+    break;
+
+  case 19: /* stmt: ';'  */
+#line 240 "seal-semant.y"
+                {
+      (yyval.stmt) = no_expr((yyloc));
+    }
+#line 1628 "seal-semant.tab.c"
+    break;
+
+  case 20: /* stmt: expr ';'  */
+#line 243 "seal-semant.y"
+               {
+      (yyval.stmt) = (yyvsp[-1].expr);
+    }
+#line 1636 "seal-semant.tab.c"
+    break;
+
+  case 21: /* stmt: ifStmt  */
+#line 246 "seal-semant.y"
+             {
+      (yyval.stmt) = (yyvsp[0].ifStmt);
+    }
+#line 1644 "seal-semant.tab.c"
+    break;
+
+  case 22: /* stmt: whileStmt  */
+#line 249 "seal-semant.y"
+                {
+      (yyval.stmt) = (yyvsp[0].whileStmt);
+    }
+#line 1652 "seal-semant.tab.c"
+    break;
+
+  case 23: /* stmt: forStmt  */
+#line 252 "seal-semant.y"
+              {
+      (yyval.stmt) = (yyvsp[0].forStmt);
+    }
+#line 1660 "seal-semant.tab.c"
+    break;
+
+  case 24: /* stmt: breakStmt  */
+#line 255 "seal-semant.y"
+                {
+      (yyval.stmt) = (yyvsp[0].breakStmt);
+    }
+#line 1668 "seal-semant.tab.c"
+    break;
+
+  case 25: /* stmt: continueStmt  */
+#line 258 "seal-semant.y"
+                   {
+      (yyval.stmt) = (yyvsp[0].continueStmt);
+    }
+#line 1676 "seal-semant.tab.c"
+    break;
+
+  case 26: /* stmt: returnStmt  */
+#line 261 "seal-semant.y"
+                 {
+      (yyval.stmt) = (yyvsp[0].returnStmt);
+    }
+#line 1684 "seal-semant.tab.c"
+    break;
+
+  case 27: /* stmt: stmtBlock  */
+#line 264 "seal-semant.y"
+                {
+      (yyval.stmt) = (yyvsp[0].stmtBlock);
+    }
+#line 1692 "seal-semant.tab.c"
+    break;
+
+  case 28: /* stmt_list: stmt  */
+#line 270 "seal-semant.y"
+                     {
+      (yyval.stmts) = single_Stmts((yyvsp[0].stmt));
+    }
+#line 1700 "seal-semant.tab.c"
+    break;
+
+  case 29: /* stmt_list: stmt_list stmt  */
+#line 273 "seal-semant.y"
+                     {
+      (yyval.stmts) = append_Stmts((yyvsp[-1].stmts), single_Stmts((yyvsp[0].stmt)));
+    }
+#line 1708 "seal-semant.tab.c"
+    break;
+
+  case 30: /* ifStmt: IF expr stmtBlock  */
+#line 279 "seal-semant.y"
+                                {
+      (yyval.ifStmt) = ifstmt((yyloc), (yyvsp[-1].expr), (yyvsp[0].stmtBlock), stmtBlock((yyloc), nil_VariableDecls(), nil_Stmts()));
+    }
+#line 1716 "seal-semant.tab.c"
+    break;
+
+  case 31: /* ifStmt: IF expr stmtBlock ELSE stmtBlock  */
+#line 282 "seal-semant.y"
+                                       {
+      (yyval.ifStmt) = ifstmt((yyloc), (yyvsp[-3].expr), (yyvsp[-2].stmtBlock), (yyvsp[0].stmtBlock));
+    }
+#line 1724 "seal-semant.tab.c"
+    break;
+
+  case 32: /* whileStmt: WHILE expr stmtBlock  */
+#line 288 "seal-semant.y"
+                                     {
+      (yyval.whileStmt) = whilestmt((yyloc), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+    }
+#line 1732 "seal-semant.tab.c"
+    break;
+
+  case 33: /* forStmt: FOR expr ';' expr ';' expr stmtBlock  */
+#line 294 "seal-semant.y"
+                                                   {
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-5].expr), (yyvsp[-3].expr), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+    }
+#line 1740 "seal-semant.tab.c"
+    break;
+
+  case 34: /* forStmt: FOR ';' expr ';' expr stmtBlock  */
+#line 297 "seal-semant.y"
+                                      {
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), (yyvsp[-3].expr), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+    }
+#line 1748 "seal-semant.tab.c"
+    break;
+
+  case 35: /* forStmt: FOR expr ';' ';' expr stmtBlock  */
+#line 300 "seal-semant.y"
+                                      {
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-4].expr), no_expr((yyloc)), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+    }
+#line 1756 "seal-semant.tab.c"
+    break;
+
+  case 36: /* forStmt: FOR expr ';' expr ';' stmtBlock  */
+#line 303 "seal-semant.y"
+                                      {
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-4].expr), (yyvsp[-2].expr), no_expr((yyloc)), (yyvsp[0].stmtBlock));
+    }
+#line 1764 "seal-semant.tab.c"
+    break;
+
+  case 37: /* forStmt: FOR ';' ';' expr stmtBlock  */
+#line 306 "seal-semant.y"
+                                 {
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), no_expr((yyloc)), (yyvsp[-1].expr), (yyvsp[0].stmtBlock));
+    }
+#line 1772 "seal-semant.tab.c"
+    break;
+
+  case 38: /* forStmt: FOR ';' expr ';' stmtBlock  */
+#line 309 "seal-semant.y"
+                                 {
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), (yyvsp[-2].expr), no_expr((yyloc)), (yyvsp[0].stmtBlock));
+    }
+#line 1780 "seal-semant.tab.c"
+    break;
+
+  case 39: /* forStmt: FOR expr ';' ';' stmtBlock  */
+#line 312 "seal-semant.y"
+                                 {
+      (yyval.forStmt) = forstmt((yyloc), (yyvsp[-3].expr), no_expr((yyloc)), no_expr((yyloc)), (yyvsp[0].stmtBlock));
+    }
+#line 1788 "seal-semant.tab.c"
+    break;
+
+  case 40: /* forStmt: FOR ';' ';' stmtBlock  */
+#line 315 "seal-semant.y"
+                            {
+      (yyval.forStmt) = forstmt((yyloc), no_expr((yyloc)), no_expr((yyloc)), no_expr((yyloc)), (yyvsp[0].stmtBlock));
+    }
+#line 1796 "seal-semant.tab.c"
+    break;
+
+  case 41: /* breakStmt: BREAK ';'  */
+#line 321 "seal-semant.y"
+                          {
+      (yyval.breakStmt) = breakstmt((yyloc));
+    }
+#line 1804 "seal-semant.tab.c"
+    break;
+
+  case 42: /* continueStmt: CONTINUE ';'  */
+#line 327 "seal-semant.y"
+                                 {
+      (yyval.continueStmt) = continuestmt((yyloc));
+    }
+#line 1812 "seal-semant.tab.c"
+    break;
+
+  case 43: /* returnStmt: RETURN expr ';'  */
+#line 333 "seal-semant.y"
+                                  {
+      (yyval.returnStmt) = returnstmt((yyloc), (yyvsp[-1].expr));
+    }
+#line 1820 "seal-semant.tab.c"
+    break;
+
+  case 44: /* returnStmt: RETURN ';'  */
+#line 336 "seal-semant.y"
+                 {
+      (yyval.returnStmt) = returnstmt((yyloc), no_expr((yyloc)));
+    }
+#line 1828 "seal-semant.tab.c"
+    break;
+
+  case 45: /* expr: OBJECTID '=' expr  */
+#line 342 "seal-semant.y"
+                              {
+      (yyval.expr) = assign((yyloc), (yyvsp[-2].symbol), (yyvsp[0].expr));
+    }
+#line 1836 "seal-semant.tab.c"
+    break;
+
+  case 46: /* expr: CONST_INT  */
+#line 345 "seal-semant.y"
+                {
+      (yyval.expr) = const_int((yyloc), (yyvsp[0].symbol));
+    }
+#line 1844 "seal-semant.tab.c"
+    break;
+
+  case 47: /* expr: CONST_STRING  */
+#line 348 "seal-semant.y"
+                   {
+      (yyval.expr) = const_string((yyloc), (yyvsp[0].symbol));
+    }
+#line 1852 "seal-semant.tab.c"
+    break;
+
+  case 48: /* expr: CONST_FLOAT  */
+#line 351 "seal-semant.y"
+                  {
+      (yyval.expr) = const_float((yyloc), (yyvsp[0].symbol));
+    }
+#line 1860 "seal-semant.tab.c"
+    break;
+
+  case 49: /* expr: CONST_BOOL  */
+#line 354 "seal-semant.y"
+                 {
+      (yyval.expr) = const_bool((yyloc), (yyvsp[0].boolean));
+    }
+#line 1868 "seal-semant.tab.c"
+    break;
+
+  case 50: /* expr: OBJECTID  */
+#line 357 "seal-semant.y"
+               {
+      (yyval.expr) = object((yyloc), (yyvsp[0].symbol));
+    }
+#line 1876 "seal-semant.tab.c"
+    break;
+
+  case 51: /* expr: call  */
+#line 360 "seal-semant.y"
+           {
+      (yyval.expr) = (yyvsp[0].call);
+    }
+#line 1884 "seal-semant.tab.c"
+    break;
+
+  case 52: /* expr: '(' expr ')'  */
+#line 363 "seal-semant.y"
+                   {
+      (yyval.expr) = (yyvsp[-1].expr);
+    }
+#line 1892 "seal-semant.tab.c"
+    break;
+
+  case 53: /* expr: expr '+' expr  */
+#line 366 "seal-semant.y"
+                    {
+      (yyval.expr) = add((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1900 "seal-semant.tab.c"
+    break;
+
+  case 54: /* expr: expr '-' expr  */
+#line 369 "seal-semant.y"
+                    {
+      (yyval.expr) = minus((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1908 "seal-semant.tab.c"
+    break;
+
+  case 55: /* expr: expr '*' expr  */
+#line 372 "seal-semant.y"
+                    {
+      (yyval.expr) = multi((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1916 "seal-semant.tab.c"
+    break;
+
+  case 56: /* expr: expr '/' expr  */
+#line 375 "seal-semant.y"
+                    {
+      (yyval.expr) = divide((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1924 "seal-semant.tab.c"
+    break;
+
+  case 57: /* expr: expr '%' expr  */
+#line 378 "seal-semant.y"
+                    {
+      (yyval.expr) = mod((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1932 "seal-semant.tab.c"
+    break;
+
+  case 58: /* expr: '-' expr  */
+#line 381 "seal-semant.y"
+                            {
+      (yyval.expr) = neg((yyloc), (yyvsp[0].expr));
+    }
+#line 1940 "seal-semant.tab.c"
+    break;
+
+  case 59: /* expr: expr '<' expr  */
+#line 384 "seal-semant.y"
+                    {
+      (yyval.expr) = lt((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1948 "seal-semant.tab.c"
+    break;
+
+  case 60: /* expr: expr LE expr  */
+#line 387 "seal-semant.y"
+                   {
+      (yyval.expr) = le((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1956 "seal-semant.tab.c"
+    break;
+
+  case 61: /* expr: expr EQUAL expr  */
+#line 390 "seal-semant.y"
+                      {
+      (yyval.expr) = equ((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1964 "seal-semant.tab.c"
+    break;
+
+  case 62: /* expr: expr NE expr  */
+#line 393 "seal-semant.y"
+                   {
+      (yyval.expr) = neq((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1972 "seal-semant.tab.c"
+    break;
+
+  case 63: /* expr: expr GE expr  */
+#line 396 "seal-semant.y"
+                   {
+      (yyval.expr) = ge((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1980 "seal-semant.tab.c"
+    break;
+
+  case 64: /* expr: expr '>' expr  */
+#line 399 "seal-semant.y"
+                    {
+      (yyval.expr) = gt((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1988 "seal-semant.tab.c"
+    break;
+
+  case 65: /* expr: expr AND expr  */
+#line 402 "seal-semant.y"
+                    {
+      (yyval.expr) = and_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 1996 "seal-semant.tab.c"
+    break;
+
+  case 66: /* expr: expr OR expr  */
+#line 405 "seal-semant.y"
+                   {
+      (yyval.expr) = or_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 2004 "seal-semant.tab.c"
+    break;
+
+  case 67: /* expr: '!' expr  */
+#line 408 "seal-semant.y"
+               {
+      (yyval.expr) = not_((yyloc), (yyvsp[0].expr));
+    }
+#line 2012 "seal-semant.tab.c"
+    break;
+
+  case 68: /* expr: '~' expr  */
+#line 411 "seal-semant.y"
+               {
+      (yyval.expr) = bitnot((yyloc), (yyvsp[0].expr));
+    }
+#line 2020 "seal-semant.tab.c"
+    break;
+
+  case 69: /* expr: expr '&' expr  */
+#line 414 "seal-semant.y"
+                    {
+      (yyval.expr) = bitand_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 2028 "seal-semant.tab.c"
+    break;
+
+  case 70: /* expr: expr '|' expr  */
+#line 417 "seal-semant.y"
+                    {
+      (yyval.expr) = bitor_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 2036 "seal-semant.tab.c"
+    break;
+
+  case 71: /* expr: expr '^' expr  */
+#line 420 "seal-semant.y"
+                    {
+      (yyval.expr) = xor_((yyloc), (yyvsp[-2].expr), (yyvsp[0].expr));
+    }
+#line 2044 "seal-semant.tab.c"
+    break;
+
+  case 72: /* call: OBJECTID '(' actual_list ')'  */
+#line 426 "seal-semant.y"
+                                         {
+      (yyval.call) = call((yyloc), (yyvsp[-3].symbol), (yyvsp[-1].actuals));
+    }
+#line 2052 "seal-semant.tab.c"
+    break;
+
+  case 73: /* call: OBJECTID '(' ')'  */
+#line 429 "seal-semant.y"
+                       {
+      (yyval.call) = call((yyloc), (yyvsp[-2].symbol), nil_Actuals());
+    }
+#line 2060 "seal-semant.tab.c"
+    break;
+
+  case 74: /* actual: expr  */
+#line 435 "seal-semant.y"
+                   {
+      (yyval.actual) = actual((yyloc), (yyvsp[0].expr));
+    }
+#line 2068 "seal-semant.tab.c"
+    break;
+
+  case 75: /* actual_list: actual  */
+#line 441 "seal-semant.y"
+                         {
+      (yyval.actuals) = single_Actuals((yyvsp[0].actual));
+    }
+#line 2076 "seal-semant.tab.c"
+    break;
+
+  case 76: /* actual_list: actual_list ',' actual  */
+#line 444 "seal-semant.y"
+                             {
+      (yyval.actuals) = append_Actuals((yyvsp[-2].actuals), single_Actuals((yyvsp[0].actual)));
+    }
+#line 2084 "seal-semant.tab.c"
+    break;
+
+
+#line 2088 "seal-semant.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (&yylloc, ctx, YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, ctx);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, ctx);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, ctx, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, ctx);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, ctx);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 451 "seal-semant.y"
+
+
+    /* This function is called automatically when Bison detects a parse error. */
+    static const DiagKind syntax_error =
+      { "syntax-error", "\"{0}\", line {line}: {1} at or near {2}\n" };
+
+    void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s)
+    {
+      std::ostringstream token;
+      print_seal_token(token, ctx->last_token);
+      ctx->diags->report(*llocp, syntax_error) << ctx->filename << s << token.str();
+      ctx->omerrs++;
+
+      if(ctx->omerrs>50) {ctx->diags->flush(); fprintf(stdout, "More than 50 errors\n"); ctx->diags->stop(1);}
+    }
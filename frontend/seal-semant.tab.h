@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -31,62 +31,59 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
-#ifndef YY_SEAL_YY_SEAL_TAB_H_INCLUDED
-# define YY_SEAL_YY_SEAL_TAB_H_INCLUDED
+#ifndef YY_SEMANT_YY_SEAL_SEMANT_TAB_H_INCLUDED
+# define YY_SEMANT_YY_SEAL_SEMANT_TAB_H_INCLUDED
 /* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 1
 #endif
 #if YYDEBUG
-extern int seal_yydebug;
+extern int semant_yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    IF = 258,
-    ELSE = 260,
-    WHILE = 261,
-    FOR = 262,
-    BREAK = 263,
-    CONTINUE = 264,
-    FUNC = 265,
-    RETURN = 266,
-    VAR = 271,
-    ERROR = 273,
-    AND = 274,
-    OR = 275,
-    EQUAL = 276,
-    NE = 277,
-    GE = 278,
-    LE = 279,
-    INT = 280,
-    STRING = 281,
-    BOOL = 282,
-    FLOAT = 283,
-    CONST_BOOL = 267,
-    CONST_INT = 268,
-    CONST_STRING = 269,
-    CONST_FLOAT = 270,
-    OBJECTID = 284,
-    TYPEID = 285,
-    UMINUS = 287,
-    neg_expr = 288,
-    bracket_expr = 289,
-    call_expr = 290,
-    object_expr = 291,
-    const_int_expr = 292,
-    const_float_expr = 293,
-    const_string_expr = 294,
-    const_bool_expr = 295
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 286,                 /* "invalid token"  */
+    IF = 258,                      /* IF  */
+    ELSE = 260,                    /* ELSE  */
+    WHILE = 261,                   /* WHILE  */
+    FOR = 262,                     /* FOR  */
+    BREAK = 263,                   /* BREAK  */
+    CONTINUE = 264,                /* CONTINUE  */
+    FUNC = 265,                    /* FUNC  */
+    RETURN = 266,                  /* RETURN  */
+    VAR = 271,                     /* VAR  */
+    AND = 274,                     /* AND  */
+    OR = 275,                      /* OR  */
+    EQUAL = 276,                   /* EQUAL  */
+    NE = 277,                      /* NE  */
+    GE = 278,                      /* GE  */
+    LE = 279,                      /* LE  */
+    CONST_BOOL = 267,              /* CONST_BOOL  */
+    CONST_INT = 268,               /* CONST_INT  */
+    CONST_STRING = 269,            /* CONST_STRING  */
+    CONST_FLOAT = 270,             /* CONST_FLOAT  */
+    OBJECTID = 284,                /* OBJECTID  */
+    TYPEID = 285,                  /* TYPEID  */
+    UMINUS = 287                   /* UMINUS  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 286
 #define IF 258
 #define ELSE 260
 #define WHILE 261
@@ -96,17 +93,12 @@ extern int seal_yydebug;
 #define FUNC 265
 #define RETURN 266
 #define VAR 271
-#define ERROR 273
 #define AND 274
 #define OR 275
 #define EQUAL 276
 #define NE 277
 #define GE 278
 #define LE 279
-#define INT 280
-#define STRING 281
-#define BOOL 282
-#define FLOAT 283
 #define CONST_BOOL 267
 #define CONST_INT 268
 #define CONST_STRING 269
@@ -114,20 +106,12 @@ extern int seal_yydebug;
 #define OBJECTID 284
 #define TYPEID 285
 #define UMINUS 287
-#define neg_expr 288
-#define bracket_expr 289
-#define call_expr 290
-#define object_expr 291
-#define const_int_expr 292
-#define const_float_expr 293
-#define const_string_expr 294
-#define const_bool_expr 295
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 89 "seal.y"
+#line 68 "seal-semant.y"
 
       Boolean boolean;
       Symbol symbol;
@@ -153,11 +137,11 @@ union YYSTYPE
       Call call;
       Actual actual;
       Actuals actuals;
-      
+
       char *error_msg;
     
 
-#line 161 "seal.tab.h"
+#line 145 "seal-semant.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -180,8 +164,9 @@ struct YYLTYPE
 #endif
 
 
-extern YYSTYPE seal_yylval;
-extern YYLTYPE seal_yylloc;
-int seal_yyparse (void);
 
-#endif /* !YY_SEAL_YY_SEAL_TAB_H_INCLUDED  */
+
+int semant_yyparse (ParseContext *ctx);
+
+
+#endif /* !YY_SEMANT_YY_SEAL_SEMANT_TAB_H_INCLUDED  */
@@ -0,0 +1,465 @@
+/*
+*  seal-semant.y
+*              Parser definition for the SEAL language as semant reads it:
+*              a declaration gives the type first ("Int x;",
+*              "Int func f(Int a) { ... }").
+*
+*/
+%{
+  #include <iostream>
+  #include "seal-decl.h"
+  #include "seal-stmt.h"
+  #include "seal-expr.h"
+  #include "stringtab.h"
+  #include "utilities.h"
+  #include "parse_context.h"
+
+  /* Locations */
+  #define YYLTYPE int              /* the type of locations */
+
+      #define YYLLOC_DEFAULT(Current, Rhs, N)         \
+      Current = Rhs[1];
+
+    /* IMPORTANT NOTE ON LINE NUMBERS
+    *********************************
+    * The above definitions cause every terminal in the grammar to have the
+    * line number supplied by the lexer, and every non-terminal to have the
+    * line number of its first symbol.  Every AST constructor takes the line
+    * number of the node as its first argument, so an action passes @$ (or
+    * any @i it prefers) explicitly:
+
+    add_consts	: INT_CONST '+' INT_CONST
+    {
+      $$ = add(@$, const_int(@1, $1), const_int(@3, $3));
+    }
+
+    * No global is involved, which keeps the parser reentrant.
+    */
+    %}
+
+    /* The parser keeps no global state: everything it produces goes into
+       the ParseContext passed to semant_yyparse(ctx). */
+    %define api.pure full
+    %parse-param {ParseContext *ctx}
+
+    %code {
+      /*
+       * The scanner is shared with seal.y, which defines seal_yylval and
+       * curr_lineno; this adapter hands them to the pure parser.
+       */
+      extern thread_local YYSTYPE seal_yylval;
+      int seal_yylex();
+
+      static int semant_yylex(YYSTYPE *lvalp, YYLTYPE *llocp, ParseContext *ctx)
+      {
+        int token = seal_yylex();
+        *lvalp = seal_yylval;
+        *llocp = curr_lineno;
+        ctx->last_token = token;
+        return token;
+      }
+
+      /* defined below; called for each parse error */
+      void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s);
+    }
+    %lex-param {ParseContext *ctx}
+
+    /* A union of all the types that can be the result of parsing actions. */
+    %union {
+      Boolean boolean;
+      Symbol symbol;
+      Program program;
+      Decl decl;
+      Decls decls;
+      VariableDecl variableDecl;
+      VariableDecls variableDecls;
+      Variable variable;
+      Variables variables;
+      CallDecl callDecl;
+      StmtBlock stmtBlock;
+      Stmt stmt;
+      Stmts stmts;
+      IfStmt ifStmt;
+      WhileStmt whileStmt;
+      ForStmt forStmt;
+      ReturnStmt returnStmt;
+      ContinueStmt continueStmt;
+      BreakStmt breakStmt;
+      Expr expr;
+      Exprs exprs;
+      Call call;
+      Actual actual;
+      Actuals actuals;
+
+      char *error_msg;
+    }
+
+    /*
+    Declare the terminals; a few have types for associated lexemes.
+    The lexer's ERROR token is not declared: it is a parse error
+    wherever the lexer returns it.
+
+    The integer following token declaration is the numeric constant used
+    to represent that token internally.  Typically, Bison generates these
+    on its own, but we give explicit numbers to prevent version parity
+    problems (bison 1.25 and earlier start at 258, later versions -- at
+    257)
+    */
+    %token IF 258 ELSE 260 WHILE 261 FOR 262 BREAK 263 CONTINUE 264
+    %token FUNC 265 RETURN 266
+    %token VAR 271
+	  %token AND 274 OR 275 EQUAL 276 NE 277 GE 278 LE 279
+    %token <boolean> CONST_BOOL 267
+    %token <symbol>  CONST_INT 268 CONST_STRING 269 CONST_FLOAT 270
+    %token <symbol>  OBJECTID 284 TYPEID 285
+
+	  %token UMINUS
+    /*  DON'T CHANGE ANYTHING ABOVE THIS LINE, OR YOUR PARSER WONT WORK       */
+    /**************************************************************************/
+
+    /* Declare types for the grammar's non-terminals. */
+    %type <program> program
+    %type <decl> decl
+    %type <decls> decl_list
+    %type <variableDecl> variableDecl
+    %type <variableDecls> variableDecl_list
+    %type <variable> variable
+    %type <variables> variable_list
+    %type <callDecl> callDecl
+    %type <stmtBlock> stmtBlock
+    %type <stmt> stmt
+    %type <stmts> stmt_list
+    %type <ifStmt> ifStmt
+    %type <whileStmt> whileStmt
+    %type <forStmt> forStmt
+    %type <breakStmt> breakStmt
+    %type <continueStmt> continueStmt
+    %type <returnStmt> returnStmt
+    %type <expr> expr
+    %type <call> call
+    %type <actual> actual
+    %type <actuals> actual_list
+
+
+    /* Precedence declarations go here. */
+    %right '='
+    %right OR
+    %right AND
+    %nonassoc EQUAL NE
+    %nonassoc '<' '>' LE GE
+    %left '+' '-'
+    %left '*' '/' '%'
+    %left '!'
+    %left UMINUS
+    %left '&' '|' '^'
+    %left '~'
+
+
+%%
+
+    /* Save the root of the abstract syntax tree in the context. */
+    program : decl_list {
+      @$ = @1;
+      ctx->ast_root = program(@$, $1);
+    }
+    ;
+
+
+    decl  : variableDecl {
+      $$ = $1;
+    }
+    | callDecl {
+      $$ = $1;
+    }
+    ;
+
+
+    decl_list : decl {
+      $$ = single_Decls($1);
+    }
+    | decl_list decl {
+      $$ = append_Decls($1, single_Decls($2));
+    }
+    ;
+
+
+    variableDecl  : variable ';' {
+      $$ = variableDecl(@$, $1);
+    }
+    ;
+
+
+    variableDecl_list : variableDecl {
+      $$ = single_VariableDecls($1);
+    }
+    | variableDecl_list variableDecl {
+      $$ = append_VariableDecls($1, single_VariableDecls($2));
+    }
+    ;
+
+
+    variable  : TYPEID OBJECTID {
+      $$ = variable(@$, $2, $1);
+    }
+    ;
+
+
+    variable_list : variable {
+      $$ = single_Variables($1);
+    }
+    | variable_list ',' variable {
+      $$ = append_Variables($1, single_Variables($3));
+    }
+    ;
+
+
+    callDecl  : TYPEID FUNC OBJECTID '(' variable_list ')' stmtBlock {
+      $$ = callDecl(@$, $3, $5, $1, $7);
+    }
+    | TYPEID FUNC OBJECTID '(' ')' stmtBlock {
+      $$ = callDecl(@$, $3, nil_Variables(), $1, $6);
+    }
+    ;
+
+
+    stmtBlock : '{' variableDecl_list stmt_list '}' {
+      $$ = stmtBlock(@$, $2, $3);
+    }
+    | '{' stmt_list '}' {
+      $$ = stmtBlock(@$, nil_VariableDecls(), $2);
+    }
+    | '{' variableDecl_list '}' {
+      $$ = stmtBlock(@$, $2, nil_Stmts());
+    }
+    | '{' '}' {
+      $$ = stmtBlock(@$, nil_VariableDecls(), nil_Stmts());
+    }
+    ;
+
+
+    stmt  : ';' {
+      $$ = no_expr(@$);
+    }
+    | expr ';' {
+      $$ = $1;
+    }
+    | ifStmt {
+      $$ = $1;
+    }
+    | whileStmt {
+      $$ = $1;
+    }
+    | forStmt {
+      $$ = $1;
+    }
+    | breakStmt {
+      $$ = $1;
+    }
+    | continueStmt {
+      $$ = $1;
+    }
+    | returnStmt {
+      $$ = $1;
+    }
+    | stmtBlock {
+      $$ = $1;
+    }
+    ;
+
+
+    stmt_list : stmt {
+      $$ = single_Stmts($1);
+    }
+    | stmt_list stmt {
+      $$ = append_Stmts($1, single_Stmts($2));
+    }
+    ;
+
+
+    ifStmt  : IF expr stmtBlock {
+      $$ = ifstmt(@$, $2, $3, stmtBlock(@$, nil_VariableDecls(), nil_Stmts()));
+    }
+    | IF expr stmtBlock ELSE stmtBlock {
+      $$ = ifstmt(@$, $2, $3, $5);
+    }
+    ;
+
+
+    whileStmt : WHILE expr stmtBlock {
+      $$ = whilestmt(@$, $2, $3);
+    }
+    ;
+
+
+    forStmt : FOR expr ';' expr ';' expr stmtBlock {
+      $$ = forstmt(@$, $2, $4, $6, $7);
+    }
+    | FOR ';' expr ';' expr stmtBlock {
+      $$ = forstmt(@$, no_expr(@$), $3, $5, $6);
+    }
+    | FOR expr ';' ';' expr stmtBlock {
+      $$ = forstmt(@$, $2, no_expr(@$), $5, $6);
+    }
+    | FOR expr ';' expr ';' stmtBlock {
+      $$ = forstmt(@$, $2, $4, no_expr(@$), $6);
+    }
+    | FOR ';' ';' expr stmtBlock {
+      $$ = forstmt(@$, no_expr(@$), no_expr(@$), $4, $5);
+    }
+    | FOR ';' expr ';' stmtBlock {
+      $$ = forstmt(@$, no_expr(@$), $3, no_expr(@$), $5);
+    }
+    | FOR expr ';' ';' stmtBlock {
+      $$ = forstmt(@$, $2, no_expr(@$), no_expr(@$), $5);
+    }
+    | FOR ';' ';' stmtBlock {
+      $$ = forstmt(@$, no_expr(@$), no_expr(@$), no_expr(@$), $4);
+    }
+    ;
+
+
+    breakStmt : BREAK ';' {
+      $$ = breakstmt(@$);
+    }
+    ;
+
+
+    continueStmt  : CONTINUE ';' {
+      $$ = continuestmt(@$);
+    }
+    ;
+
+
+    returnStmt  : RETURN expr ';' {
+      $$ = returnstmt(@$, $2);
+    }
+    | RETURN ';' {
+      $$ = returnstmt(@$, no_expr(@$));
+    }
+    ;
+
+
+    expr  : OBJECTID '=' expr {
+      $$ = assign(@$, $1, $3);
+    }
+    | CONST_INT {
+      $$ = const_int(@$, $1);
+    }
+    | CONST_STRING {
+      $$ = const_string(@$, $1);
+    }
+    | CONST_FLOAT {
+      $$ = const_float(@$, $1);
+    }
+    | CONST_BOOL {
+      $$ = const_bool(@$, $1);
+    }
+    | OBJECTID {
+      $$ = object(@$, $1);
+    }
+    | call {
+      $$ = $1;
+    }
+    | '(' expr ')' {
+      $$ = $2;
+    }
+    | expr '+' expr {
+      $$ = add(@$, $1, $3);
+    }
+    | expr '-' expr {
+      $$ = minus(@$, $1, $3);
+    }
+    | expr '*' expr {
+      $$ = multi(@$, $1, $3);
+    }
+    | expr '/' expr {
+      $$ = divide(@$, $1, $3);
+    }
+    | expr '%' expr {
+      $$ = mod(@$, $1, $3);
+    }
+    | '-' expr %prec UMINUS {
+      $$ = neg(@$, $2);
+    }
+    | expr '<' expr {
+      $$ = lt(@$, $1, $3);
+    }
+    | expr LE expr {
+      $$ = le(@$, $1, $3);
+    }
+    | expr EQUAL expr {
+      $$ = equ(@$, $1, $3);
+    }
+    | expr NE expr {
+      $$ = neq(@$, $1, $3);
+    }
+    | expr GE expr {
+      $$ = ge(@$, $1, $3);
+    }
+    | expr '>' expr {
+      $$ = gt(@$, $1, $3);
+    }
+    | expr AND expr {
+      $$ = and_(@$, $1, $3);
+    }
+    | expr OR expr {
+      $$ = or_(@$, $1, $3);
+    }
+    | '!' expr {
+      $$ = not_(@$, $2);
+    }
+    | '~' expr {
+      $$ = bitnot(@$, $2);
+    }
+    | expr '&' expr {
+      $$ = bitand_(@$, $1, $3);
+    }
+    | expr '|' expr {
+      $$ = bitor_(@$, $1, $3);
+    }
+    | expr '^' expr {
+      $$ = xor_(@$, $1, $3);
+    }
+    ;
+
+
+    call  : OBJECTID '(' actual_list ')' {
+      $$ = call(@$, $1, $3);
+    }
+    | OBJECTID '(' ')' {
+      $$ = call(@$, $1, nil_Actuals());
+    }
+    ;
+
+
+    actual  : expr {
+      $$ = actual(@$, $1);
+    }
+    ;
+
+
+    actual_list : actual {
+      $$ = single_Actuals($1);
+    }
+    | actual_list ',' actual {
+      $$ = append_Actuals($1, single_Actuals($3));
+    }
+    ;
+
+
+    /* end of grammar */
+%%
+
+    /* This function is called automatically when Bison detects a parse error. */
+    static const DiagKind syntax_error =
+      { "syntax-error", "\"{0}\", line {line}: {1} at or near {2}\n" };
+
+    void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s)
+    {
+      std::ostringstream token;
+      print_seal_token(token, ctx->last_token);
+      ctx->diags->report(*llocp, syntax_error) << ctx->filename << s << token.str();
+      ctx->omerrs++;
+
+      if(ctx->omerrs>50) {ctx->diags->flush(); fprintf(stdout, "More than 50 errors\n"); ctx->diags->stop(1);}
+    }
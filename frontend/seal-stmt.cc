@@ -5,7 +5,7 @@
 
 Program Program_class::copy_Program()
 {
-   return new Program_class(decls->copy_list());
+   return new Program_class(line_number, decls->copy_list());
 }
 
 void Program_class::dump(ostream& stream, int n)
@@ -16,7 +16,7 @@ void Program_class::dump(ostream& stream, int n)
 
 StmtBlock StmtBlock_class::copy_StmtBlock()
 {
-   return new StmtBlock_class(vars->copy_list(), stmts->copy_list());
+   return new StmtBlock_class(line_number, vars->copy_list(), stmts->copy_list());
 }
 
 void StmtBlock_class::dump(ostream& stream, int n)
@@ -29,7 +29,7 @@ void StmtBlock_class::dump(ostream& stream, int n)
 
 Stmt IfStmt_class::copy_Stmt()
 {
-   return new IfStmt_class(condition->copy_Expr(), thenexpr->copy_StmtBlock(), elseexpr->copy_StmtBlock());
+   return new IfStmt_class(line_number, condition->copy_Expr(), thenexpr->copy_StmtBlock(), elseexpr->copy_StmtBlock());
 }
 
 
@@ -44,7 +44,7 @@ void IfStmt_class::dump(ostream& stream, int n)
 
 Stmt WhileStmt_class::copy_Stmt()
 {
-   return new WhileStmt_class(condition->copy_Expr(), body->copy_StmtBlock());
+   return new WhileStmt_class(line_number, condition->copy_Expr(), body->copy_StmtBlock());
 }
 
 
@@ -58,7 +58,7 @@ void WhileStmt_class::dump(ostream& stream, int n)
 
 Stmt ForStmt_class::copy_Stmt()
 {
-   return new ForStmt_class(initexpr->copy_Expr(), condition->copy_Expr(), loopact->copy_Expr(), body->copy_StmtBlock());
+   return new ForStmt_class(line_number, initexpr->copy_Expr(), condition->copy_Expr(), loopact->copy_Expr(), body->copy_StmtBlock());
 }
 
 
@@ -74,7 +74,7 @@ void ForStmt_class::dump(ostream& stream, int n)
 
 Stmt BreakStmt_class::copy_Stmt()
 {
-   return new BreakStmt_class();
+   return new BreakStmt_class(line_number);
 }
 
 
@@ -86,7 +86,7 @@ void BreakStmt_class::dump(ostream& stream, int n)
 
 Stmt ContinueStmt_class::copy_Stmt()
 {
-   return new ContinueStmt_class();
+   return new ContinueStmt_class(line_number);
 }
 
 
@@ -97,7 +97,7 @@ void ContinueStmt_class::dump(ostream& stream, int n)
 
 Stmt ReturnStmt_class::copy_Stmt()
 {
-   return new ReturnStmt_class(value->copy_Expr());
+   return new ReturnStmt_class(line_number, value->copy_Expr());
 }
 
 
@@ -122,42 +122,42 @@ Stmts append_Stmts(Stmts p1, Stmts p2)
 }
 
 
-Program program(Decls a1)
+Program program(int line, Decls a1)
 {
-   return new Program_class(a1);
+   return new Program_class(line, a1);
 };
 
-StmtBlock stmtBlock(VariableDecls a1, Stmts a2)
+StmtBlock stmtBlock(int line, VariableDecls a1, Stmts a2)
 {
-  return new StmtBlock_class(a1, a2);
+  return new StmtBlock_class(line, a1, a2);
 }
 
-IfStmt ifstmt(Expr a1, StmtBlock a2, StmtBlock a3)
+IfStmt ifstmt(int line, Expr a1, StmtBlock a2, StmtBlock a3)
 {
-  return new IfStmt_class(a1, a2, a3);
+  return new IfStmt_class(line, a1, a2, a3);
 }
 
-WhileStmt whilestmt(Expr a1, StmtBlock a2)
+WhileStmt whilestmt(int line, Expr a1, StmtBlock a2)
 {
-  return new WhileStmt_class(a1, a2);
+  return new WhileStmt_class(line, a1, a2);
 }
 
-ForStmt forstmt(Expr a1, Expr a2, Expr a3, StmtBlock a4)
+ForStmt forstmt(int line, Expr a1, Expr a2, Expr a3, StmtBlock a4)
 {
-	return new ForStmt_class(a1,a2,a3,a4);
+	return new ForStmt_class(line, a1,a2,a3,a4);
 }
 
-ReturnStmt returnstmt(Expr a1)
+ReturnStmt returnstmt(int line, Expr a1)
 {
-  return new ReturnStmt_class(a1);
+  return new ReturnStmt_class(line, a1);
 }
 
-ContinueStmt continuestmt()
+ContinueStmt continuestmt(int line)
 {
-  return new ContinueStmt_class();
+  return new ContinueStmt_class(line);
 }
 
-BreakStmt breakstmt()
+BreakStmt breakstmt(int line)
 {
-  return new BreakStmt_class();
+  return new BreakStmt_class(line);
 }
\ No newline at end of file
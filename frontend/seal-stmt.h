@@ -10,13 +10,16 @@ class Program_class : public tree_node {
 protected:
     Decls decls;
 public:
-    Program_class(Decls a1) {
+    Program_class(int line, Decls a1) : tree_node(line) {
        decls = a1;
     }
     Program copy_Program();
+    Decls getDecls() { return decls; }
 	tree_node *copy()		 { return copy_Program(); }
     void dump(ostream& stream, int n);
     void dump_with_types(ostream&, int);
+    void encode(TreeEncoder &);
+    void shift_lines(int delta);
 
 	void semant();
 	// for semantic analysis
@@ -25,9 +28,13 @@ public:
 
 class Stmt_class : public tree_node {
 public:
+	Stmt_class(int line) : tree_node(line) { }
 	tree_node *copy()		 { return copy_Stmt(); }
 	virtual Stmt copy_Stmt() = 0;
 	virtual void dump_with_types(ostream&,int) = 0; 
+	virtual void encode(TreeEncoder &) = 0;
+	virtual void fingerprint(Fingerprint &) = 0;
+	virtual Stmt fold_Stmt(Folder &) = 0;
 	virtual void dump(ostream&,int) = 0;
 	virtual void check(Symbol) = 0;
 };
@@ -37,7 +44,7 @@ protected:
 	 VariableDecls vars;
 	 Stmts	stmts;
 public:
-	StmtBlock_class(VariableDecls a1, Stmts a2) {
+	StmtBlock_class(int line, VariableDecls a1, Stmts a2) : Stmt_class(line) {
 		vars = a1;
 	    stmts = a2;
 	}
@@ -49,6 +56,10 @@ public:
 	void check(Symbol);
 	void dump(ostream& , int );
 	void dump_with_types(ostream&,int);
+	void encode(TreeEncoder &);
+	void shift_lines(int delta);
+	void fingerprint(Fingerprint &);
+	Stmt fold_Stmt(Folder &);
 };
 
 class IfStmt_class : public Stmt_class {
@@ -57,7 +68,7 @@ protected:
 	Expr condition;
 	StmtBlock thenexpr, elseexpr;
 public:
-    IfStmt_class(Expr a1, StmtBlock a2, StmtBlock a3) {
+    IfStmt_class(int line, Expr a1, StmtBlock a2, StmtBlock a3) : Stmt_class(line) {
 		condition = a1;
 		thenexpr = a2;
 		elseexpr = a3;
@@ -69,6 +80,10 @@ public:
 	void check(Symbol);
 	void dump(ostream& stream, int n);
 	void dump_with_types(ostream&,int);
+	void encode(TreeEncoder &);
+	void shift_lines(int delta);
+	void fingerprint(Fingerprint &);
+	Stmt fold_Stmt(Folder &);
 };
 
 
@@ -79,7 +94,7 @@ protected:
 	Expr condition;
 	StmtBlock body;
 public:
-    WhileStmt_class(Expr a1, StmtBlock a2) {
+    WhileStmt_class(int line, Expr a1, StmtBlock a2) : Stmt_class(line) {
 		condition = a1;
 		body = a2;
 	}
@@ -89,6 +104,10 @@ public:
 	void check(Symbol);
 	void dump(ostream& stream, int n);
 	void dump_with_types(ostream&,int);
+	void encode(TreeEncoder &);
+	void shift_lines(int delta);
+	void fingerprint(Fingerprint &);
+	Stmt fold_Stmt(Folder &);
 };
 
 class ForStmt_class : public Stmt_class {
@@ -96,7 +115,7 @@ protected:
 	Expr initexpr, condition, loopact;
 	StmtBlock body;
 public:
-	ForStmt_class(Expr a1, Expr a2, Expr a3, StmtBlock a4) {
+	ForStmt_class(int line, Expr a1, Expr a2, Expr a3, StmtBlock a4) : Stmt_class(line) {
 		initexpr = a1;
 		condition = a2;
 		loopact = a3;
@@ -110,6 +129,10 @@ public:
     Stmt copy_Stmt();
 	void dump(ostream& stream, int n);
 	void dump_with_types(ostream&,int);
+	void encode(TreeEncoder &);
+	void shift_lines(int delta);
+	void fingerprint(Fingerprint &);
+	Stmt fold_Stmt(Folder &);
 };
 
 
@@ -118,32 +141,42 @@ class ReturnStmt_class : public Stmt_class {
 protected:
     Expr value;
 public:
-	ReturnStmt_class(Expr a2) {
+	ReturnStmt_class(int line, Expr a2) : Stmt_class(line) {
         value = a2;
     }
 	Expr getValue(){return value;}
     Stmt copy_Stmt();
 	void check(Symbol);
     void dump_with_types(ostream&,int);
+    void encode(TreeEncoder &);
+    void shift_lines(int delta);
+    void fingerprint(Fingerprint &);
+    Stmt fold_Stmt(Folder &);
     void dump(ostream& stream, int n);
 };
 
 class ContinueStmt_class : public Stmt_class {
 public:
-	ContinueStmt_class() {}
+	ContinueStmt_class(int line) : Stmt_class(line) {}
     Stmt copy_Stmt();
 	void check(Symbol);
     void dump_with_types(ostream&,int);
+    void encode(TreeEncoder &);
+    void fingerprint(Fingerprint &);
+    Stmt fold_Stmt(Folder &);
     void dump(ostream& stream, int n);
 };
 
 
 class BreakStmt_class : public Stmt_class {
 public:
-	BreakStmt_class() {}
+	BreakStmt_class(int line) : Stmt_class(line) {}
     Stmt copy_Stmt();
 	void check(Symbol);
     void dump_with_types(ostream&,int);
+    void encode(TreeEncoder &);
+    void fingerprint(Fingerprint &);
+    Stmt fold_Stmt(Folder &);
     void dump(ostream& stream, int n);
 };
 
@@ -199,13 +232,13 @@ BreakStmts nil_BreakStmts();
 BreakStmts single_BreakStmts(BreakStmt);
 BreakStmts append_BreakStmts(BreakStmts,BreakStmts);
 
-Program program(Decls);
-StmtBlock stmtBlock(VariableDecls, Stmts);
-IfStmt ifstmt(Expr, StmtBlock, StmtBlock);
-WhileStmt whilestmt(Expr, StmtBlock);
-ForStmt forstmt(Expr, Expr, Expr, StmtBlock);
-ReturnStmt returnstmt(Expr);
-ContinueStmt continuestmt();
-BreakStmt breakstmt();
+Program program(int, Decls);
+StmtBlock stmtBlock(int, VariableDecls, Stmts);
+IfStmt ifstmt(int, Expr, StmtBlock, StmtBlock);
+WhileStmt whilestmt(int, Expr, StmtBlock);
+ForStmt forstmt(int, Expr, Expr, Expr, StmtBlock);
+ReturnStmt returnstmt(int, Expr);
+ContinueStmt continuestmt(int);
+BreakStmt breakstmt(int);
 
 #endif
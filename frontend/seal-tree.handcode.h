@@ -9,7 +9,7 @@
 #include "seal.h"
 #include "stringtab.h"
 #define yylineno curr_lineno;
-extern int yylineno;
+extern thread_local int yylineno;
 
 inline Boolean copy_Boolean(Boolean b) {return b; }
 inline void assert_Boolean(Boolean) {}
@@ -58,6 +58,10 @@ class Actual_class;
 typedef Actual_class *Actual;
 class Constant_class;
 typedef Constant_class *Constant;
+class Fingerprint;
+class Folder;
+struct FoldValue;
+class TreeEncoder;
 
 
 typedef list_node<VariableDecl> VariableDecls_class;
@@ -0,0 +1,211 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_SEAL_YY_SEAL_TAB_H_INCLUDED
+# define YY_SEAL_YY_SEAL_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int seal_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 286,                 /* "invalid token"  */
+    IF = 258,                      /* IF  */
+    ELSE = 260,                    /* ELSE  */
+    WHILE = 261,                   /* WHILE  */
+    FOR = 262,                     /* FOR  */
+    BREAK = 263,                   /* BREAK  */
+    CONTINUE = 264,                /* CONTINUE  */
+    FUNC = 265,                    /* FUNC  */
+    RETURN = 266,                  /* RETURN  */
+    VAR = 271,                     /* VAR  */
+    ERROR = 273,                   /* ERROR  */
+    AND = 274,                     /* AND  */
+    OR = 275,                      /* OR  */
+    EQUAL = 276,                   /* EQUAL  */
+    NE = 277,                      /* NE  */
+    GE = 278,                      /* GE  */
+    LE = 279,                      /* LE  */
+    INT = 280,                     /* INT  */
+    STRING = 281,                  /* STRING  */
+    BOOL = 282,                    /* BOOL  */
+    FLOAT = 283,                   /* FLOAT  */
+    CONST_BOOL = 267,              /* CONST_BOOL  */
+    CONST_INT = 268,               /* CONST_INT  */
+    CONST_STRING = 269,            /* CONST_STRING  */
+    CONST_FLOAT = 270,             /* CONST_FLOAT  */
+    OBJECTID = 284,                /* OBJECTID  */
+    TYPEID = 285,                  /* TYPEID  */
+    UMINUS = 287,                  /* UMINUS  */
+    neg_expr = 288,                /* neg_expr  */
+    bracket_expr = 289,            /* bracket_expr  */
+    call_expr = 290,               /* call_expr  */
+    object_expr = 291,             /* object_expr  */
+    const_int_expr = 292,          /* const_int_expr  */
+    const_float_expr = 293,        /* const_float_expr  */
+    const_string_expr = 294,       /* const_string_expr  */
+    const_bool_expr = 295          /* const_bool_expr  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 286
+#define IF 258
+#define ELSE 260
+#define WHILE 261
+#define FOR 262
+#define BREAK 263
+#define CONTINUE 264
+#define FUNC 265
+#define RETURN 266
+#define VAR 271
+#define ERROR 273
+#define AND 274
+#define OR 275
+#define EQUAL 276
+#define NE 277
+#define GE 278
+#define LE 279
+#define INT 280
+#define STRING 281
+#define BOOL 282
+#define FLOAT 283
+#define CONST_BOOL 267
+#define CONST_INT 268
+#define CONST_STRING 269
+#define CONST_FLOAT 270
+#define OBJECTID 284
+#define TYPEID 285
+#define UMINUS 287
+#define neg_expr 288
+#define bracket_expr 289
+#define call_expr 290
+#define object_expr 291
+#define const_int_expr 292
+#define const_float_expr 293
+#define const_string_expr 294
+#define const_bool_expr 295
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 72 "seal.y"
+
+      Boolean boolean;
+      Symbol symbol;
+      Program program;
+      Decl decl;
+      Decls decls;
+      VariableDecl variableDecl;
+      VariableDecls variableDecls;
+      Variable variable;
+      Variables variables;
+      CallDecl callDecl;
+      StmtBlock stmtBlock;
+      Stmt stmt;
+      Stmts stmts;
+      IfStmt ifStmt;
+      WhileStmt whileStmt;
+      ForStmt forStmt;
+      ReturnStmt returnStmt;
+      ContinueStmt continueStmt;
+      BreakStmt breakStmt;
+      Expr expr;
+      Exprs exprs;
+      Call call;
+      Actual actual;
+      Actuals actuals;
+      
+      char *error_msg;
+    
+
+#line 171 "seal.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+#ifndef YYPUSH_MORE_DEFINED
+# define YYPUSH_MORE_DEFINED
+enum { YYPUSH_MORE = 4 };
+#endif
+
+typedef struct seal_yypstate seal_yypstate;
+
+
+int seal_yyparse (ParseContext *ctx);
+int seal_yypush_parse (seal_yypstate *ps,
+                  int pushed_char, YYSTYPE const *pushed_val, YYLTYPE *pushed_loc, ParseContext *ctx);
+int seal_yypull_parse (seal_yypstate *ps, ParseContext *ctx);
+seal_yypstate *seal_yypstate_new (void);
+void seal_yypstate_delete (seal_yypstate *ps);
+
+
+#endif /* !YY_SEAL_YY_SEAL_TAB_H_INCLUDED  */
@@ -10,80 +10,63 @@
   #include "seal-expr.h"
   #include "stringtab.h"
   #include "utilities.h"
+  #include "parse_context.h"
 
-  extern char *curr_filename;
   /* Locations */
   #define YYLTYPE int              /* the type of locations */
-  #define seal_yylloc curr_lineno  /* use the curr_lineno from the lexer
-  for the location of tokens */
     
-    extern int node_lineno;          /* set before constructing a tree node
-    to whatever you want the line number
-    for the tree node to be */
-      
-      
       #define YYLLOC_DEFAULT(Current, Rhs, N)         \
-      Current = Rhs[1];                             \
-      node_lineno = Current;
-    
-    
-    #define SET_NODELOC(Current)  \
-    node_lineno = Current;
+      Current = Rhs[1];
     
     /* IMPORTANT NOTE ON LINE NUMBERS
     *********************************
-    * The above definitions and macros cause every terminal in your grammar to 
-    * have the line number supplied by the lexer. The only task you have to
-    * implement for line numbers to work correctly, is to use SET_NODELOC()
-    * before constructing any constructs from non-terminals in your grammar.
-    * Example: Consider you are matching on the following very restrictive 
-    * (fictional) construct that matches a plus between two integer constants. 
-    * (SUCH A RULE SHOULD NOT BE PART OF YOUR PARSER):
-    
-    add_consts	: INT_CONST '+' INT_CONST 
-    
-    * where INT_CONST is a terminal for an integer constant. Now, a correct
-    * action for this rule that attaches the correct line number to plus_const
-    * would look like the following:
+    * The above definitions cause every terminal in the grammar to have the
+    * line number supplied by the lexer, and every non-terminal to have the
+    * line number of its first symbol.  Every AST constructor takes the line
+    * number of the node as its first argument, so an action passes @$ (or
+    * any @i it prefers) explicitly:
     
     add_consts	: INT_CONST '+' INT_CONST 
     {
-      // Set the line number of the current non-terminal:
-      // ***********************************************
-      // You can access the line numbers of the i'th item with @i, just
-      // like you acess the value of the i'th exporession with $i.
-      //
-      // Here, we choose the line number of the last INT_CONST (@3) as the
-      // line number of the resulting expression (@$). You are free to pick
-      // any reasonable line as the line number of non-terminals. If you 
-      // omit the statement @$=..., bison has default rules for deciding which 
-      // line number to use. Check the manual for details if you are interested.
-      @$ = @3;
-      
-      
-      // Observe that we call SET_NODELOC(@3); this will set the global variable
-      // node_lineno to @3. Since the constructor call "plus" uses the value of 
-      // this global, the plus node will now have the correct line number.
-      SET_NODELOC(@3);
-      
-      // construct the result node:
-      $$ = add(int_const($1), int_const($3));
+      $$ = add(@$, const_int(@1, $1), const_int(@3, $3));
     }
     
+    * No global is involved, which keeps the parser reentrant.
     */
-    
-    
-    
-    void yyerror(char *s);        /*  defined below; called for each parse error */
-    extern int yylex();           /*  the entry point to the lexer  */
-    
-    /************************************************************************/
-    /*                DONT CHANGE ANYTHING IN THIS SECTION                  */
-    
-    Program ast_root;	      /* the result of the parse  */
-    //Decls parse_results;        /* for use in semantic analysis */
-    int omerrs = 0;               /* number of errors in lexing and parsing */
     %}
+
+    /* The parser keeps no global state: everything it produces goes into
+       the ParseContext passed to seal_yyparse(ctx). */
+    %define api.pure full
+    %parse-param {ParseContext *ctx}
+
+    /* Generate both the classic seal_yyparse() and the push interface
+       (seal_yypstate_new / seal_yypush_parse) used for streaming input. */
+    %define api.push-pull both
+
+    %code {
+      /*
+       * The scanner leaves the value of each token in seal_yylval and its
+       * line in curr_lineno, both private to the thread scanning.  They
+       * are defined here, and this adapter hands them to the pure parser.
+       */
+      thread_local YYSTYPE seal_yylval;
+      thread_local int curr_lineno = 1;
+      int seal_yylex();
+
+      static int seal_yylex(YYSTYPE *lvalp, YYLTYPE *llocp, ParseContext *ctx)
+      {
+        int token = seal_yylex();
+        *lvalp = seal_yylval;
+        *llocp = curr_lineno;
+        ctx->last_token = token;
+        return token;
+      }
+
+      /* defined below; called for each parse error */
+      void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s);
+    }
+    %lex-param {ParseContext *ctx}
     
     /* A union of all the types that can be the result of parsing actions. */
     %union {
@@ -190,7 +173,7 @@
 	/* Add more rules here */
     program : decl_list {
       @$ = @1;
-      ast_root = program($1); 
+      ctx->ast_root = program(@$, $1); 
     }
     ;
     
@@ -205,16 +188,18 @@
 
 
     decl_list : decl {
+      if (ctx->decl_handler) ctx->decl_handler($1);
       $$ = single_Decls($1);
     }
     | decl_list decl {
+      if (ctx->decl_handler) ctx->decl_handler($2);
       $$ = append_Decls($1, single_Decls($2));
     }
     ;
 
 
     variableDecl  : VAR variable ';' {
-      $$ = variableDecl($2);
+      $$ = variableDecl(@$, $2);
     }
     ;
 
@@ -229,7 +214,7 @@
 
 
     variable  : OBJECTID TYPEID {
-      $$ = variable($1, $2);
+      $$ = variable(@$, $1, $2);
     }
     ;
 
@@ -247,28 +232,28 @@
 
 
     callDecl  : FUNC OBJECTID '(' variable_list ')' TYPEID stmtBlock {     
-      $$ = callDecl($2, $4, $6, $7);
+      $$ = callDecl(@$, $2, $4, $6, $7);
     }
     ;
 
 
     stmtBlock : '{' variableDecl_list stmt_list '}' {
-      $$ = stmtBlock($2, $3);
+      $$ = stmtBlock(@$, $2, $3);
     }
     | '{' stmt_list '}' {
-      $$ = stmtBlock(nil_VariableDecls(), $2);
+      $$ = stmtBlock(@$, nil_VariableDecls(), $2);
     }
     | '{' variableDecl_list '}' {
-      $$ = stmtBlock($2, nil_Stmts());
+      $$ = stmtBlock(@$, $2, nil_Stmts());
     }
     | '{' '}' {
-      $$ = stmtBlock(nil_VariableDecls(), nil_Stmts());
+      $$ = stmtBlock(@$, nil_VariableDecls(), nil_Stmts());
     }
     ;
 
 
     stmt  : ';' {
-      $$ = no_expr();
+      $$ = no_expr(@$);
     }
     | expr ';' {
       $$ = $1;
@@ -307,82 +292,82 @@
 
 
     ifStmt  : IF expr stmtBlock ELSE stmtBlock {
-      $$ = ifstmt($2, $3, $5);
+      $$ = ifstmt(@$, $2, $3, $5);
     }
     | IF expr stmtBlock {
-      $$ = ifstmt($2, $3, stmtBlock(nil_VariableDecls(), nil_Stmts()));
+      $$ = ifstmt(@$, $2, $3, stmtBlock(@$, nil_VariableDecls(), nil_Stmts()));
     }
     ;
 
 
     whileStmt : WHILE expr stmtBlock {
-      $$ = whilestmt($2, $3);
+      $$ = whilestmt(@$, $2, $3);
     }
     ;
 
 
     forStmt : FOR expr ';' expr ';' expr stmtBlock {
-      $$ = forstmt($2, $4, $6, $7);
+      $$ = forstmt(@$, $2, $4, $6, $7);
     }
     | FOR ';' expr ';' expr stmtBlock {
-      $$ = forstmt(no_expr(), $3, $5, $6);
+      $$ = forstmt(@$, no_expr(@$), $3, $5, $6);
     }
     | FOR expr ';' ';' expr stmtBlock {
-      $$ = forstmt($2, no_expr(), $5, $6);
+      $$ = forstmt(@$, $2, no_expr(@$), $5, $6);
     }
     | FOR expr ';' expr ';' stmtBlock {
-      $$ = forstmt($2, $4, no_expr(), $6);
+      $$ = forstmt(@$, $2, $4, no_expr(@$), $6);
     }
     | FOR ';' ';' expr stmtBlock {
-      $$ = forstmt(no_expr(), no_expr(), $4, $5);
+      $$ = forstmt(@$, no_expr(@$), no_expr(@$), $4, $5);
     }
     | FOR ';' expr ';' stmtBlock {
-      $$ = forstmt(no_expr(), $3, no_expr(), $5);
+      $$ = forstmt(@$, no_expr(@$), $3, no_expr(@$), $5);
     }
     | FOR expr ';' ';' stmtBlock {
-      $$ = forstmt($2, no_expr(), no_expr(), $5);
+      $$ = forstmt(@$, $2, no_expr(@$), no_expr(@$), $5);
     }
     | FOR ';' ';' stmtBlock {
-      $$ = forstmt(no_expr(), no_expr(), no_expr(), $4);
+      $$ = forstmt(@$, no_expr(@$), no_expr(@$), no_expr(@$), $4);
     }
     ;
 
 
     returnStmt  : RETURN expr ';' {
-      $$ = returnstmt($2);
+      $$ = returnstmt(@$, $2);
     }
     | RETURN ';' {
-      $$ = returnstmt(no_expr());
+      $$ = returnstmt(@$, no_expr(@$));
     }
     ;
 
 
     continueStmt  : CONTINUE ';' {
-      $$ = continuestmt();
+      $$ = continuestmt(@$);
     }
     ;
 
 
     breakStmt : BREAK ';' {
-      $$ = breakstmt();
+      $$ = breakstmt(@$);
     }
     ;
 
 
     expr  : OBJECTID '=' expr {
-      $$ = assign($1, $3);
+      $$ = assign(@$, $1, $3);
     }
     | CONST_BOOL %prec const_bool_expr {
-      $$ = const_bool($1);
+      $$ = const_bool(@$, $1);
     }
     | CONST_INT %prec const_int_expr {
-      $$ = const_int($1);
+      $$ = const_int(@$, $1);
     }
     | CONST_STRING %prec const_string_expr {
-      $$ = const_string($1);
+      $$ = const_string(@$, $1);
     }
     | CONST_FLOAT %prec const_float_expr {
-      $$ = const_float($1);
+      $$ = const_float(@$, $1);
     }
     | call %prec call_expr {
       $$ = $1;
@@ -391,80 +376,80 @@
       $$ = $2;
     }
     | OBJECTID %prec object_expr {
-      $$ = object($1);
+      $$ = object(@$, $1);
     }
     | expr '+' expr {
-      $$ = add($1, $3);
+      $$ = add(@$, $1, $3);
     }
     | expr '-' expr {
-      $$ = minus($1, $3);
+      $$ = minus(@$, $1, $3);
     }
     | expr '*' expr {
-      $$ = multi($1, $3);
+      $$ = multi(@$, $1, $3);
     }
     | expr '/' expr {
-      $$ = divide($1, $3);
+      $$ = divide(@$, $1, $3);
     }
     | expr '%' expr {
-      $$ = mod($1, $3);
+      $$ = mod(@$, $1, $3);
     }
     | '-' expr %prec neg_expr {
-      $$ = neg($2);
+      $$ = neg(@$, $2);
     }
     | expr '<' expr {
-      $$ = lt($1, $3);
+      $$ = lt(@$, $1, $3);
     }
     | expr LE expr {
-      $$ = le($1, $3);
+      $$ = le(@$, $1, $3);
     }
     | expr EQUAL expr {
-      $$ = equ($1, $3);
+      $$ = equ(@$, $1, $3);
     }
     | expr NE expr {
-      $$ = neq($1, $3);
+      $$ = neq(@$, $1, $3);
     }
     | expr GE expr {
-      $$ = ge($1, $3);
+      $$ = ge(@$, $1, $3);
     }
     | expr '>' expr {
-      $$ = gt($1, $3);
+      $$ = gt(@$, $1, $3);
     }
     | expr AND expr {
-      $$ = and_($1, $3);
+      $$ = and_(@$, $1, $3);
     }
     | expr OR expr {
-      $$ = or_($1, $3);
+      $$ = or_(@$, $1, $3);
     }
     | expr '^' expr {
-      $$ = xor_($1, $3);
+      $$ = xor_(@$, $1, $3);
     }
     | '!' expr {
-      $$ = not_($2);
+      $$ = not_(@$, $2);
     }
     | '~' expr {
-      $$ = bitnot($2);
+      $$ = bitnot(@$, $2);
     }
     | expr '&' expr {
-      $$ = bitand_($1, $3);
+      $$ = bitand_(@$, $1, $3);
     }
     | expr '|' expr {
-      $$ = bitor_($1, $3);
+      $$ = bitor_(@$, $1, $3);
     }
     ;
 
 
     call  : OBJECTID '(' actual_list ')' {
       if($3 -> len() != 0) {
-        $$ = call($1, $3);
+        $$ = call(@$, $1, $3);
       } else {
-        $$ = call($1, nil_Actuals());
+        $$ = call(@$, $1, nil_Actuals());
       }      
     }
     ;
 
 
     actual  : expr {
-      $$ = actual($1);
+      $$ = actual(@$, $1);
     }
     ;
 
@@ -485,15 +470,38 @@
 %%
     
     /* This function is called automatically when Bison detects a parse error. */
-    void yyerror(char *s)
+    static const DiagKind syntax_error =
+      { "syntax-error", "\"{0}\", line {line}: {1} at or near {2}\n" };
+
+    void yyerror(YYLTYPE *llocp, ParseContext *ctx, const char *s)
     {
-      extern int curr_lineno;
+      std::ostringstream token;
+      print_seal_token(token, ctx->last_token);
+      ctx->diags->report(*llocp, syntax_error) << ctx->filename << s << token.str();
+      ctx->omerrs++;
       
-      cerr << "\"" << curr_filename << "\", line " << curr_lineno << ": " \
-      << s << " at or near ";
-      print_seal_token(yychar);
-      cerr << endl;
-      omerrs++;
-      
-      if(omerrs>50) {fprintf(stdout, "More than 50 errors\n"); exit(1);}
+      if(ctx->omerrs>50) {ctx->diags->flush(); fprintf(stdout, "More than 50 errors\n"); ctx->diags->stop(1);}
+    }
+
+    /* 
+     * Drive the push parser with tokens pulled from the lexer.  The lexer
+     * consumes its input as it arrives, so when fin is a pipe every complete
+     * top-level declaration reaches ctx->decl_handler while the producer is
+     * still writing the rest of the program.  Returns 0 on success like
+     * seal_yyparse().
+     */
+    int seal_yyparse_stream(ParseContext *ctx)
+    {
+      seal_yypstate *ps = seal_yypstate_new();
+      YYSTYPE lval;
+      YYLTYPE lloc;
+      int status;
+
+      do {
+        int token = seal_yylex(&lval, &lloc, ctx);
+        status = seal_yypush_parse(ps, token, &lval, &lloc, ctx);
+      } while (status == YYPUSH_MORE);
+
+      seal_yypstate_delete(ps);
+      return status;
     }
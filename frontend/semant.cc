@@ -0,0 +1,1200 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include "semant.h"
+#include "utilities.h"
+#include "workpool.h"
+#include "diagnostics.h"
+#include "fingerprint.h"
+#include "semcache.h"
+#include "callgraph.h"
+#include "fold.h"
+
+extern int semant_debug;
+extern thread_local char *curr_filename;
+extern int jobs;
+extern char *cache_dir;
+extern int remove_dead_decls;
+extern int check_dead_decls;
+extern int cgen_optimize;
+
+static int semant_errors = 0;
+static Decl curr_decl = 0;
+
+typedef SymbolTable<Symbol, Symbol> ObjectEnvironment; // name, type
+ObjectEnvironment objectEnv;
+
+typedef SymbolTable<Symbol, Binding> VariableEnvironment; // name, binding
+VariableEnvironment *global_var_table = new VariableEnvironment();
+// the same bindings by the index of the name in idtable, for the cache
+static std::vector<Binding *> global_of;
+// the declaration of each global, by slot
+static std::vector<Decl> global_decls;
+
+//
+// The signature index, built once by install_calls(): for every function
+// its return type and the types of its parameters, which are kept one
+// function after another in param_types.  signature_of maps the index of
+// a name in idtable to its signature, or -1.  Signature i is that of
+// function i of call_graph, until check_calls() builds the graph without
+// the functions -D dropped.
+//
+struct Signature {
+    Symbol return_type;
+    int first_param;
+    int arity;
+};
+static std::vector<Signature> signatures;
+static std::vector<Symbol> param_types;
+static std::vector<int> signature_of;
+
+static const Signature *find_signature(Symbol name) {
+    int i = name->get_index();
+    if (i >= (int) signature_of.size() || signature_of[i] < 0)
+        return NULL;
+    return &signatures[signature_of[i]];
+}
+
+//
+// The state of checking one function.  The tables above are filled
+// before any function is checked and only read afterwards; everything a
+// check changes lives here, so check_calls() can check the functions on
+// several threads.  Their errors are kept in the context and written out
+// in source order once all are done.
+//
+struct CheckContext {
+    bool has_return;
+    Symbol return_type;
+    int stmt_level, call_level, loop_level;
+    int local_slots;     // locals declared so far in the function
+    std::vector<int> calls;   // the functions called, as in call_graph
+    VariableEnvironment formal_par_table;
+    VariableEnvironment local_var_table;
+    DiagnosticEngine diags;
+
+    CheckContext() : has_return(false), return_type(NULL), stmt_level(0),
+        call_level(0), loop_level(0), local_slots(0) { }
+};
+
+// the function being checked on this thread
+static thread_local CheckContext *cc = NULL;
+
+///////////////////////////////////////////////
+// helper func
+///////////////////////////////////////////////
+
+
+static DiagArgs semant_error(int line, const DiagKind &kind) {
+    if (cc != NULL)
+        return cc->diags.report(line, kind);
+    semant_errors++;
+    return diagnostics.report(line, kind);
+}
+
+static DiagArgs semant_error(const DiagKind &kind) {
+    return semant_error(0, kind);
+}
+
+static DiagArgs semant_error(tree_node *t, const DiagKind &kind) {
+    return semant_error(t->get_line_number(), kind);
+}
+
+//
+// The errors of semantic analysis.
+//
+static const DiagKind
+    printf_defined = { "printf-defined", "{line}: Function printf cannot be defined.\n" },
+    function_redefined = { "function-redefined", "{line}: Function {0} has already been defined.\n" },
+    void_variable = { "void-variable", "{line}: Variable {0} cannot have Void type.\n" },
+    variable_redefined = { "variable-redefined", "{line}: Variable {0} has already been defined.\n" },
+    no_main = { "no-main", "Main function has not been defined\n" },
+    main_not_void = { "main-not-void", "{line}: Main function should have return Void type.\n" },
+    main_has_parameters = { "main-has-parameters", "{line}: Main function should not have parameters.\n" },
+    bad_return_type = { "bad-return-type", "{line}: Return type: {0} is incorrect.\n" },
+    too_many_parameters = { "too-many-parameters", "{line}: Function {0} should not have more than six parameters.\n" },
+    void_parameter = { "void-parameter", "{line}: Function {0}'s parameter {1} cannot have Void type.\n" },
+    parameter_redeclared = { "parameter-redeclared", "{line}: Function {0}'s parameter {1} has already been declared.\n" },
+    no_return = { "no-return", "{line}: Function {0} must have an overall return statement.\n" },
+    bad_condition = { "bad-condition", "{line}: Condition type must be Bool, not {0}.\n" },
+    return_mismatch = { "return-mismatch", "{line}: Returns {0} , but need {1}\n" },
+    continue_outside_loop = { "continue-outside-loop", "{line}: continue must be used in a loop sentence.\n" },
+    break_outside_loop = { "break-outside-loop", "{line}: break must be used in a loop sentence.\n" },
+    printf_no_arguments = { "printf-no-arguments", "{line}: printf function must have at least one parameter.\n" },
+    printf_format_not_string = { "printf-format-not-string", "{line}: printf function's first parameter must be String type.\n" },
+    undefined_function = { "undefined-function", "{line}: Function {0} has not been defined.\n" },
+    argument_count = { "argument-count", "{line}: Function {0} is used with wrong number of parameters.\n" },
+    argument_type = { "argument-type", "{line}: Function {0}, the {1} parameter should be {2} but provided a {3}.\n" },
+    undefined_lvalue = { "undefined-lvalue", "{line}: Left value {0} has not been defined.\n" },
+    assign_mismatch = { "assign-mismatch", "{line}: Right value's type is {0} but needs {1}.\n" },
+    undefined_object = { "undefined-object", "{line}: object {0} has not been defined.\n" };
+
+//////////////////////////////////////////////////////////////////////
+//
+// Symbols
+//
+// For convenience, a large number of symbols are predefined here.
+// These symbols include the primitive type and method names, as well
+// as fixed names used by the runtime system.
+//
+//////////////////////////////////////////////////////////////////////
+
+static Symbol 
+    Int,
+    Float,
+    String,
+    Bool,
+    Void,
+    Main,
+    print
+    ;
+
+// ids of the types for operator typing, and their symbols
+enum TypeId { TInt, TFloat, TBool, TString, TVoid, TOther, NTypeIds, TError = NTypeIds };
+static Symbol type_symbols[NTypeIds];
+
+bool isValidCallName(Symbol type) {
+    return type != (Symbol)print;
+}
+
+bool isValidTypeName(Symbol type) {
+    return type != Void;
+}
+
+//
+// Initializing the predefined symbols.
+//
+
+void initialize_constants(void) {
+    // 4 basic types and Void type
+    Bool        = idtable.add_string("Bool");
+    Int         = idtable.add_string("Int");
+    String      = idtable.add_string("String");
+    Float       = idtable.add_string("Float");
+    Void        = idtable.add_string("Void");  
+    // Main function
+    Main        = idtable.add_string("main");
+
+    // classical function to print things, so defined here for call.
+    print        = idtable.add_string("printf");
+
+    type_symbols[TInt] = Int;
+    type_symbols[TFloat] = Float;
+    type_symbols[TBool] = Bool;
+    type_symbols[TString] = String;
+    type_symbols[TVoid] = Void;
+}
+
+/*
+    TODO :
+    you should fill the following function defines, so that semant() can realize a semantic 
+    analysis in a recursive way. 
+    Of course, you can add any other functions to help.
+*/
+
+//
+// Bind a name to the variable it refers to: a local shadows a parameter,
+// which shadows a global.
+//
+static Binding *resolve(Symbol name) {
+    Binding *b = cc->local_var_table.lookup(name);
+    if (b == NULL)
+        b = cc->formal_par_table.probe(name);
+    if (b == NULL)
+        b = global_var_table->lookup(name);
+    return b;
+}
+
+//
+// The left side of an assignment has always taken the global of that name
+// first, then the parameter, and only then the local; kept that way so
+// that the checker accepts and rejects the same programs.
+//
+static Binding *resolve_lvalue(Symbol name) {
+    Binding *b = global_var_table->lookup(name);
+    if (b == NULL)
+        b = cc->formal_par_table.probe(name);
+    if (b == NULL)
+        b = cc->local_var_table.lookup(name);
+    return b;
+}
+
+static bool sameType(Symbol name1, Symbol name2) {
+    return strcmp(name1->get_string(), name2->get_string()) == 0;
+}
+
+static void install_calls(Decls decls) {
+    for (int i = decls->first(); decls->more(i); i = decls->next(i)) {
+        Decl decl = decls->nth(i);
+        if (!decl->isCallDecl()) continue;
+        if (decl->getName() == print)
+            semant_error(decl, printf_defined);
+        else if (find_signature(decl->getName()) == NULL) {
+            std::vector<Variable> vars;
+            decl->getVariables()->collect(vars);
+            Signature sig = { decl->getType(), (int) param_types.size(), (int) vars.size() };
+            for (size_t k = 0; k < vars.size(); k++)
+                param_types.push_back(vars[k]->getType());
+
+            int index = decl->getName()->get_index();
+            if (index >= (int) signature_of.size())
+                signature_of.resize(index + 1, -1);
+            signature_of[index] = signatures.size();
+            signatures.push_back(sig);
+            call_graph.functions.push_back((CallDecl) decl);
+        }
+        else
+            semant_error(decl, function_redefined) << decl->getName();
+    }
+}
+
+static void install_globalVars(Decls decls) {
+    int slot = 0;
+    global_var_table->enterscope();
+    for (int i = decls->first(); decls->more(i); i = decls->next(i)) {
+        Decl decl = decls->nth(i);
+        if (decl->isCallDecl()) continue;
+        else if (decl->getType() == Void)
+            semant_error(decl, void_variable) << decl->getName();
+        else if (global_var_table->lookup(decl->getName()) == NULL) {
+            Binding *b = new Binding(Binding::Global, slot++, decl->getType());
+            global_var_table->addid(decl->getName(), b);
+
+            int index = decl->getName()->get_index();
+            if (index >= (int) global_of.size())
+                global_of.resize(index + 1, NULL);
+            global_of[index] = b;
+            global_decls.push_back(decl);
+        }
+        else
+            semant_error(decl, variable_redefined) << decl->getName();
+    }
+}
+
+static void add_context(Fingerprint &f);
+static std::string saved_check(Fingerprint &f, const DiagnosticEngine &diags);
+static bool restore_check(Fingerprint &f, const std::string &payload, DiagnosticEngine &diags);
+
+//
+// With a cache directory (-C), each function is first looked up in the
+// cache under what its check would read.  One that is found is not
+// checked: its types, bindings and errors are restored from the cache.
+// The others are checked and then stored.  Restoring adds to idtable, so
+// it is the one step not done on the threads.
+//
+static void check_calls(const std::vector<CallDecl> &calls, const std::vector<bool> &dropped) {
+    std::vector<CheckContext> contexts(calls.size());
+    std::vector<Fingerprint> prints(cache_dir != NULL ? calls.size() : 0);
+    std::vector<CacheKey> keys(prints.size());
+    std::vector<std::string> payloads(prints.size());
+    run_parallel(prints.size(), jobs, [&](int i) {
+        calls[i]->fingerprint(prints[i]);
+        add_context(prints[i]);
+        keys[i] = prints[i].hash.key();
+        cache_load(cache_dir, keys[i], payloads[i]);
+    });
+
+    std::vector<int> todo;
+    for (size_t i = 0; i < calls.size(); i++) {
+        if (cache_dir != NULL && !payloads[i].empty() &&
+            restore_check(prints[i], payloads[i], contexts[i].diags)) {
+            for (Symbol name : prints[i].callees)
+                if (const Signature *sig = find_signature(name))
+                    contexts[i].calls.push_back(sig - signatures.data());
+            continue;
+        }
+        todo.push_back(i);
+    }
+
+    run_parallel(todo.size(), jobs, [&](int k) {
+        cc = &contexts[todo[k]];
+        calls[todo[k]]->check();
+        cc = NULL;
+    });
+
+    if (cache_dir != NULL) {
+        run_parallel(todo.size(), jobs, [&](int k) {
+            std::string payload = saved_check(prints[todo[k]], contexts[todo[k]].diags);
+            if (!payload.empty())
+                cache_store(cache_dir, keys[todo[k]], payload);
+        });
+        if (semant_debug)
+            cerr << "semantic cache: " << calls.size() - todo.size() << " of "
+                 << calls.size() << " functions restored\n";
+    }
+
+    std::vector<std::vector<int> > edges(call_graph.size());
+    for (size_t i = 0; i < contexts.size(); i++) {
+        semant_errors += contexts[i].diags.count();
+        diagnostics.append(contexts[i].diags);
+
+        const Signature *sig = find_signature(calls[i]->getName());
+        if (sig != NULL && call_graph.functions[sig - signatures.data()] == calls[i])
+            edges[sig - signatures.data()].swap(contexts[i].calls);
+    }
+    call_graph.build(edges, dropped);
+}
+
+static void check_main() {
+    if (find_signature(Main) == NULL)
+        semant_error(no_main);
+}
+
+void VariableDecl_class::check() {
+    if (getType() == Void)
+        semant_error(this, void_variable) << getName();
+}
+
+void CallDecl_class::check() {
+    cc->call_level++;
+    if (getName() == Main) {
+        if (getType() != Void)
+            semant_error(this, main_not_void);
+        if (getVariables()->len() > 0)
+            semant_error(this, main_has_parameters);
+    }
+    if (getType() != Int && getType() != Void && getType() != String && getType() != Float && getType() != Bool)
+        semant_error(this, bad_return_type) << getType();
+    if (getVariables()->len() > 6)
+        semant_error(this, too_many_parameters) << getName();
+    cc->formal_par_table.enterscope();
+    cc->local_slots = 0;
+    Variables vars = getVariables();
+    for (int i = vars->first(); vars->more(i); i = vars->next(i)) {
+        Variable var = vars->nth(i);
+        if (var->getType() == Void)
+            semant_error(var, void_parameter) << getName() << var->getName();
+        else if (cc->formal_par_table.probe(var->getName()) == NULL)
+            cc->formal_par_table.addid(var->getName(),
+                new Binding(Binding::Param, i, var->getType()));
+        else
+            semant_error(var, parameter_redeclared) << getName() << var->getName();
+    }
+
+    cc->has_return = false;
+    cc->return_type = getType();
+    getBody()->check(Int);
+    if (!cc->has_return)
+        semant_error(this, no_return) << getName();
+
+    cc->call_level--;
+    cc->formal_par_table.exitscope();
+}
+
+void StmtBlock_class::check(Symbol type) {
+    cc->stmt_level++;
+    cc->local_var_table.enterscope();
+    VariableDecls vars = getVariableDecls();
+    for (int i = vars->first(); vars->more(i); i = vars->next(i)) {
+        VariableDecl var = vars->nth(i);
+        var->check();
+        if (cc->local_var_table.probe(var->getName()) == NULL)
+            cc->local_var_table.addid(var->getName(),
+                new Binding(Binding::Local, cc->local_slots++, var->getType()));
+        else
+            semant_error(var, variable_redefined) << var->getName();
+    }
+
+    Stmts sts = getStmts();
+    for (int i = sts->first(); sts->more(i); i = sts->next(i)) {
+        sts->nth(i)->check(Int);
+    }
+
+    cc->stmt_level--;
+    cc->local_var_table.exitscope();
+}
+
+void IfStmt_class::check(Symbol type) {
+    getCondition()->check(Int);
+    if (getCondition()->getType() != Bool) {
+        semant_error(this, bad_condition) << condition->getType();
+    }
+    getThen()->check(Int);
+    getElse()->check(Int);
+}
+
+void WhileStmt_class::check(Symbol type) {
+    cc->loop_level++;
+    getCondition()->check(Int);
+    if (getCondition()->getType() != Bool) {
+        semant_error(this, bad_condition) << condition->getType();
+    }
+    getBody()->check(Int);
+    cc->loop_level--;
+}
+
+void ForStmt_class::check(Symbol type) {
+    cc->loop_level++;
+    getInit()->check(Int);
+    getCondition()->check(Int);
+    if (getCondition()->is_empty_Expr() == false)
+        if (getCondition()->getType() != Bool)
+            semant_error(this, bad_condition) << condition->getType();
+    getLoop()->check(Int);
+    getBody()->check(Int);
+    cc->loop_level--;
+}
+
+void ReturnStmt_class::check(Symbol type) {
+    if (cc->stmt_level == cc->call_level) cc->has_return = true;
+    getValue()->check(Int);
+    if (cc->return_type != getValue()->getType()) {
+        semant_error(this, return_mismatch) << getValue()->getType() << cc->return_type;
+    }
+}
+
+void ContinueStmt_class::check(Symbol type) {
+    if (cc->loop_level == 0) {
+        semant_error(this, continue_outside_loop);
+    }
+}
+
+void BreakStmt_class::check(Symbol type) {
+    if (cc->loop_level == 0) {
+        semant_error(this, break_outside_loop);
+    }
+}
+
+Symbol Call_class::checkType(){
+    Actuals acts = getActuals();
+    if (getName() == print) {
+        if (acts->len() < 1) {
+            semant_error(this, printf_no_arguments);
+        } else {
+            int i = acts->first();
+            Actual one = acts->nth(i);
+            one->check(Int);
+            if (one->getType() != String) {
+                semant_error(one, printf_format_not_string);
+            } else {
+                for (i = acts->next(i); acts->more(i); i = acts->next(i))
+                    acts->nth(i)->check(Int);
+            }
+        }
+        setType(Void);
+        return getType();
+    }
+
+    const Signature *sig = find_signature(getName());
+    if (sig == NULL) {
+        semant_error(this, undefined_function) << getName();
+        setType(Void);
+        return getType();
+    }
+    cc->calls.push_back(sig - signatures.data());
+
+    std::vector<Actual> args;
+    acts->collect(args);
+    if ((int) args.size() != sig->arity) {
+        semant_error(this, argument_count) << getName();
+    } else {
+        const Symbol *params = param_types.data() + sig->first_param;
+        for (int i = 0; i < sig->arity; i++) {
+            args[i]->check(Int);
+            if (args[i]->getType() != params[i]) {
+                semant_error(this, argument_type) << getName() << i + 1
+                    << params[i] << args[i]->getType();
+                break;
+            }
+        }
+    }
+    setType(sig->return_type);
+    return getType();
+}
+
+Symbol Actual_class::checkType(){
+    expr->check(Int);
+    setType(expr->getType());
+    return getType();
+}
+
+Symbol Assign_class::checkType(){
+    value->check(Int);
+    binding = resolve_lvalue(lvalue);
+    if (binding == NULL) {
+        semant_error(this, undefined_lvalue) << lvalue;
+        setType(Void);
+        return getType();
+    }
+
+    Symbol s = binding->type;
+    if (s != value->getType()) {
+        semant_error(this, assign_mismatch) << value->getType() << s;
+    }
+    setType(s);
+    return getType();
+}
+
+//
+// Operator typing.  Operand types are mapped to TypeIds, and what an
+// operator gives for each pair of operand ids is looked up in a table
+// built at compile time; TError marks a combination that is rejected.
+// Adding an operator or a type is an edit to the tables below.
+//
+
+enum BinaryOp {
+    OpAdd, OpMinus, OpMulti, OpDivide, OpMod,
+    OpLt, OpLe, OpGe, OpGt, OpEqu, OpNeq,
+    OpAnd, OpOr, OpXor, OpBitand, OpBitor,
+    NBinaryOps
+};
+
+enum UnaryOp { OpNeg, OpNot, OpBitnot, NUnaryOps };
+
+struct OperatorTables {
+    unsigned char binary[NBinaryOps][NTypeIds][NTypeIds];
+    unsigned char unary[NUnaryOps][NTypeIds];
+
+    constexpr OperatorTables() : binary(), unary() {
+        for (int op = 0; op < NBinaryOps; op++)
+            for (int t1 = 0; t1 < NTypeIds; t1++)
+                for (int t2 = 0; t2 < NTypeIds; t2++)
+                    binary[op][t1][t2] = TError;
+        for (int op = 0; op < NUnaryOps; op++)
+            for (int t = 0; t < NTypeIds; t++)
+                unary[op][t] = TError;
+
+        // Int op Int is Int; Float with Float or Int is Float
+        const BinaryOp arith[] = { OpAdd, OpMinus, OpMulti, OpDivide };
+        for (BinaryOp op : arith) {
+            binary[op][TInt][TInt] = TInt;
+            binary[op][TInt][TFloat] = binary[op][TFloat][TInt] =
+                binary[op][TFloat][TFloat] = TFloat;
+        }
+        binary[OpMod][TInt][TInt] = TInt;
+
+        // numbers compare to Bool; == and != also take two Bools
+        const BinaryOp compare[] = { OpLt, OpLe, OpGe, OpGt, OpEqu, OpNeq };
+        for (BinaryOp op : compare)
+            binary[op][TInt][TInt] = binary[op][TInt][TFloat] =
+                binary[op][TFloat][TInt] = binary[op][TFloat][TFloat] = TBool;
+        binary[OpEqu][TBool][TBool] = binary[OpNeq][TBool][TBool] = TBool;
+
+        binary[OpAnd][TBool][TBool] = binary[OpOr][TBool][TBool] = TBool;
+        binary[OpXor][TBool][TBool] = TBool;
+        binary[OpXor][TInt][TInt] = TInt;
+        binary[OpBitand][TInt][TInt] = binary[OpBitor][TInt][TInt] = TInt;
+
+        unary[OpNeg][TInt] = TInt;
+        unary[OpNeg][TFloat] = TFloat;
+        unary[OpNot][TBool] = TBool;
+        unary[OpBitnot][TInt] = TInt;
+    }
+};
+
+static constexpr OperatorTables operator_tables;
+
+// how a rejected operation is reported, with the operand types
+static const DiagKind binary_error[NBinaryOps] = {
+    { "bad-add", "{line}: cannot add a {0} and a {1}\n" },
+    { "bad-minus", "{line}: cannot minus a {0} and a {1}\n" },
+    { "bad-multi", "{line}: cannot multiply a {0} and a {1}\n" },
+    { "bad-divide", "{line}: cannot divide a {0} and a {1}\n" },
+    { "bad-mod", "{line}: cannot mod a {0} and a {1}\n" },
+    { "bad-lt", "{line}: cannot compare a {0} and a {1}\n" },
+    { "bad-le", "{line}: cannot compare a {0} and a {1}\n" },
+    { "bad-ge", "{line}: cannot compare a {0} and a {1}\n" },
+    { "bad-gt", "{line}: cannot compare a {0} and a {1}\n" },
+    { "bad-equ", "{line}: cannot compare a {0} and a {1}\n" },
+    { "bad-neq", "{line}: cannot compare a {0} and a {1}\n" },
+    { "bad-and", "{line}: cannot AND a {0} and a {1}\n" },
+    { "bad-or", "{line}: cannot OR between a {0} and a {1}\n" },
+    { "bad-xor", "{line}: cannot XOR between a {0} and a {1}\n" },
+    { "bad-bitand", "{line}: cannot bitand between a {0} and a {1}\n" },
+    { "bad-bitor", "{line}: cannot bitor between a {0} and a {1}\n" },
+};
+
+static const DiagKind unary_error[NUnaryOps] = {
+    { "bad-neg", "{line}: {0} has not negative\n" },
+    { "bad-not", "{line}: cannot NOT a {0}\n" },
+    { "bad-bitnot", "{line}: cannot bitnot a {0}\n" },
+};
+
+static TypeId type_id(Symbol t) {
+    if (t == Int) return TInt;
+    if (t == Float) return TFloat;
+    if (t == Bool) return TBool;
+    if (t == String) return TString;
+    if (t == Void) return TVoid;
+    return TOther;
+}
+
+//
+// An operator that takes an Int with a Float gets the Int as an explicit
+// IntToFloat, so that the two operands of every operator have one type.
+//
+static Expr to_float(Expr e) {
+    return int_to_float(e->get_line_number(), e)->setType(Float);
+}
+
+static void convert_operands(Expr &e1, Expr &e2) {
+    if (e1->getType() == Int && e2->getType() == Float)
+        e1 = to_float(e1);
+    else if (e1->getType() == Float && e2->getType() == Int)
+        e2 = to_float(e2);
+}
+
+static Symbol check_binary(Expr e, BinaryOp op, Expr &e1, Expr &e2) {
+    e1->check(Int);
+    e2->check(Int);
+    Symbol t1 = e1->getType(), t2 = e2->getType();
+    int t = operator_tables.binary[op][type_id(t1)][type_id(t2)];
+
+    if (t == TError) {
+        semant_error(e, binary_error[op]) << t1 << t2;
+        e->setType(Void);
+    } else {
+        e->setType(type_symbols[t]);
+        convert_operands(e1, e2);
+    }
+    return e->getType();
+}
+
+static Symbol check_unary(Expr e, UnaryOp op, Expr e1) {
+    e1->check(Int);
+    Symbol t1 = e1->getType();
+    int t = operator_tables.unary[op][type_id(t1)];
+
+    if (t == TError) {
+        semant_error(e, unary_error[op]) << t1;
+        e->setType(Void);
+    } else
+        e->setType(type_symbols[t]);
+    return e->getType();
+}
+
+Symbol Add_class::checkType(){
+    return check_binary(this, OpAdd, e1, e2);
+}
+
+Symbol Minus_class::checkType(){
+    return check_binary(this, OpMinus, e1, e2);
+}
+
+Symbol Multi_class::checkType(){
+    return check_binary(this, OpMulti, e1, e2);
+}
+
+Symbol Divide_class::checkType(){
+    return check_binary(this, OpDivide, e1, e2);
+}
+
+Symbol Mod_class::checkType(){
+    return check_binary(this, OpMod, e1, e2);
+}
+
+Symbol Neg_class::checkType(){
+    return check_unary(this, OpNeg, e1);
+}
+
+Symbol Lt_class::checkType(){
+    return check_binary(this, OpLt, e1, e2);
+}
+
+Symbol Le_class::checkType(){
+    return check_binary(this, OpLe, e1, e2);
+}
+
+Symbol Equ_class::checkType(){
+    return check_binary(this, OpEqu, e1, e2);
+}
+
+Symbol Neq_class::checkType(){
+    return check_binary(this, OpNeq, e1, e2);
+}
+
+Symbol Ge_class::checkType(){
+    return check_binary(this, OpGe, e1, e2);
+}
+
+Symbol Gt_class::checkType(){
+    return check_binary(this, OpGt, e1, e2);
+}
+
+Symbol And_class::checkType(){
+    return check_binary(this, OpAnd, e1, e2);
+}
+
+Symbol Or_class::checkType(){
+    return check_binary(this, OpOr, e1, e2);
+}
+
+Symbol Xor_class::checkType(){
+    return check_binary(this, OpXor, e1, e2);
+}
+
+Symbol Not_class::checkType(){
+    return check_unary(this, OpNot, e1);
+}
+
+Symbol Bitand_class::checkType(){
+    return check_binary(this, OpBitand, e1, e2);
+}
+
+Symbol Bitor_class::checkType(){
+    return check_binary(this, OpBitor, e1, e2);
+}
+
+Symbol Bitnot_class::checkType(){
+    return check_unary(this, OpBitnot, e1);
+}
+
+Symbol IntToFloat_class::checkType(){
+    e1->check(Int);
+    setType(Float);
+    return type;
+}
+
+Symbol Const_int_class::checkType(){
+    setType(Int);
+    return type;
+}
+
+Symbol Const_string_class::checkType(){
+    setType(String);
+    return type;
+}
+
+Symbol Const_float_class::checkType(){
+    setType(Float);
+    return type;
+}
+
+Symbol Const_bool_class::checkType(){
+    setType(Bool);
+    return type;
+}
+
+Symbol Object_class::checkType(){
+    binding = resolve(var);
+    if (binding == NULL) {
+        semant_error(this, undefined_object) << var;
+        setType(Void);
+        return getType();
+    }
+
+    setType(binding->type);
+    return getType();
+}
+
+Symbol No_expr_class::checkType(){
+    setType(Void);
+    return getType();
+}
+
+//
+// The semantic cache.  The check of a function reads its tree, which is
+// in its Fingerprint, and outside of it the type and slot of the global
+// of each name it uses and the signature of each function it calls,
+// which add_context() adds to the fingerprint.  So does build_id(), a hash
+// of the executable, so that a checker changed in any of its files does
+// not take old results.  What is stored is, in words and numbers
+// separated by white space,
+//
+//      <count>                         the errors, each as
+//      <line> <code> <count>           line relative to the function,
+//      <length>:<argument> ...         and its arguments
+//      <count> <name> ...              the types used below
+//      <count> <types>                 the type of each expression
+//      <count> <kind> <slot> <type> ...  the binding of each Object and
+//                                      Assign, kind -1 for none
+//
+// where a type is 1 + its index among the types used, or 0 for none, and
+// types has one character for each expression, '0' + its type.  A
+// function with more types than that can spell is not stored.
+//
+
+static const DiagKind *const check_errors[] = {
+    &main_not_void, &main_has_parameters, &bad_return_type,
+    &too_many_parameters, &void_parameter, &parameter_redeclared,
+    &no_return, &void_variable, &variable_redefined, &bad_condition,
+    &return_mismatch, &continue_outside_loop, &break_outside_loop,
+    &printf_no_arguments, &printf_format_not_string, &undefined_function,
+    &argument_count, &argument_type, &undefined_lvalue, &assign_mismatch,
+    &undefined_object,
+};
+
+static const DiagKind *find_check_error(const std::string &code) {
+    for (const DiagKind *kind : check_errors)
+        if (code == kind->code)
+            return kind;
+    for (const DiagKind &kind : binary_error)
+        if (code == kind.code)
+            return &kind;
+    for (const DiagKind &kind : unary_error)
+        if (code == kind.code)
+            return &kind;
+    return NULL;
+}
+
+static void add_context(Fingerprint &f) {
+    CacheKey build = build_id();
+    f.hash.add(build.key);
+    f.hash.add(build.check);
+    f.count(SEMANT_CACHE_VERSION);
+
+    // each name once, in the order of first use; mark is by idtable index
+    static thread_local std::vector<int> mark;
+    static thread_local int stamp = 0;
+    auto first_use = [](Symbol name) {
+        int index = name->get_index();
+        if (index >= (int) mark.size())
+            mark.resize(index + 1, 0);
+        if (mark[index] == stamp)
+            return false;
+        mark[index] = stamp;
+        return true;
+    };
+
+    stamp++;
+    for (Symbol name : f.names) {
+        if (!first_use(name))
+            continue;
+        int index = name->get_index();
+        Binding *b = index < (int) global_of.size() ? global_of[index] : NULL;
+        f.symbol(name);
+        if (b != NULL) {
+            f.symbol(b->type);
+            f.count(b->slot);
+        } else
+            f.count(-1);
+    }
+    stamp++;
+    f.count(-1);
+    for (Symbol name : f.callees) {
+        if (!first_use(name))
+            continue;
+        const Signature *sig = find_signature(name);
+        f.symbol(name);
+        if (sig != NULL) {
+            f.symbol(sig->return_type);
+            f.count(sig->arity);
+            for (int i = 0; i < sig->arity; i++)
+                f.symbol(param_types[sig->first_param + i]);
+        } else
+            f.count(-1);
+    }
+}
+
+static const size_t max_types = 'z' - '0';
+
+static std::string saved_check(Fingerprint &f, const DiagnosticEngine &diags) {
+    std::string out;
+    const std::vector<Diagnostic> &errors = diags.collected();
+    out += std::to_string(errors.size()) + "\n";
+    for (const Diagnostic &d : errors) {
+        out += std::to_string(d.line - f.base_line) + " " + d.kind->code + " " +
+            std::to_string(d.args.size()) + "\n";
+        for (const std::string &arg : d.args)
+            out += std::to_string(arg.size()) + ":" + arg + "\n";
+    }
+
+    std::vector<Symbol> types;
+    auto type_number = [&types](Symbol t) {
+        if (t == NULL)
+            return 0;
+        size_t k = std::find(types.begin(), types.end(), t) - types.begin();
+        if (k == types.size())
+            types.push_back(t);
+        return (int) k + 1;
+    };
+    std::string exprs = std::to_string(f.exprs.size()) + " ";
+    for (Expr e : f.exprs)
+        exprs += (char) ('0' + type_number(e->getType()));
+    std::string bindings = std::to_string(f.bindings.size());
+    for (Binding **slot : f.bindings) {
+        Binding *b = *slot;
+        if (b != NULL)
+            bindings += " " + std::to_string(b->kind) + " " + std::to_string(b->slot) +
+                " " + std::to_string(type_number(b->type));
+        else
+            bindings += " -1 0 0";
+    }
+
+    if (types.size() > max_types)
+        return "";
+    out += std::to_string(types.size());
+    for (Symbol t : types)
+        out += std::string(" ") + t->get_string();
+    out += "\n" + exprs + "\n" + bindings + "\n";
+    return out;
+}
+
+//
+// Reading a payload.  Each read skips white space and fails at the end
+// or on something of the wrong form.
+//
+struct PayloadReader {
+    const char *p, *end;
+
+    PayloadReader(const std::string &s) : p(s.c_str()), end(s.c_str() + s.size()) { }
+
+    void skip() {
+        while (p < end && isspace((unsigned char) *p))
+            p++;
+    }
+    bool number(long &n) {
+        char *q;
+        skip();
+        n = strtol(p, &q, 10);
+        if (q == p || q > end)
+            return false;
+        p = q;
+        return true;
+    }
+    bool word(std::string &w) {
+        skip();
+        const char *q = p;
+        while (q < end && !isspace((unsigned char) *q))
+            q++;
+        w.assign(p, q);
+        p = q;
+        return !w.empty();
+    }
+    bool bytes(long n, std::string &s) {
+        if (n < 0 || n > end - p)
+            return false;
+        s.assign(p, n);
+        p += n;
+        return true;
+    }
+};
+
+// idtable is searched from the front, so the few type names are kept here
+static Symbol restored_type(const std::string &name) {
+    static std::map<std::string, Symbol> types;
+    Symbol &type = types[name];
+    if (type == NULL)
+        type = idtable.add_string((char *) name.c_str());
+    return type;
+}
+
+//
+// Read all of the payload before changing anything, so that one which
+// does not fit the function leaves it to be checked as usual.
+//
+static bool restore_check(Fingerprint &f, const std::string &payload, DiagnosticEngine &diags) {
+    PayloadReader in(payload);
+    long count;
+
+    std::vector<Diagnostic> errors;
+    if (!in.number(count))
+        return false;
+    for (long i = 0; i < count; i++) {
+        Diagnostic d;
+        std::string code;
+        long line, nargs;
+        if (!in.number(line) || !in.word(code) || !in.number(nargs))
+            return false;
+        if ((d.kind = find_check_error(code)) == NULL)
+            return false;
+        d.line = f.base_line + line;
+        for (long k = 0; k < nargs; k++) {
+            long length;
+            std::string arg;
+            if (!in.number(length) || !in.bytes(1, arg) || arg != ":" || !in.bytes(length, arg))
+                return false;
+            d.args.push_back(arg);
+        }
+        errors.push_back(d);
+    }
+
+    std::vector<Symbol> types(1, (Symbol) NULL);
+    if (!in.number(count))
+        return false;
+    for (long i = 0; i < count; i++) {
+        std::string name;
+        if (!in.word(name))
+            return false;
+        types.push_back(restored_type(name));
+    }
+
+    std::string exprs;
+    if (!in.number(count) || count != (long) f.exprs.size() || !in.bytes(1, exprs) ||
+        !in.bytes(count, exprs))
+        return false;
+    for (char t : exprs)
+        if (t < '0' || t >= '0' + (long) types.size())
+            return false;
+
+    std::vector<long> bindings(3 * f.bindings.size());
+    if (!in.number(count) || count != (long) f.bindings.size())
+        return false;
+    for (size_t i = 0; i < bindings.size(); i += 3)
+        if (!in.number(bindings[i]) || !in.number(bindings[i + 1]) ||
+            !in.number(bindings[i + 2]) || bindings[i] > Binding::Local ||
+            bindings[i + 2] < 0 || bindings[i + 2] >= (long) types.size())
+            return false;
+
+    for (const Diagnostic &d : errors) {
+        DiagArgs args = diags.report(d.line, *d.kind);
+        for (const std::string &arg : d.args)
+            args << arg;
+    }
+    for (size_t i = 0; i < exprs.size(); i++)
+        f.exprs[i]->setType(types[exprs[i] - '0']);
+    for (size_t i = 0; i < f.operands.size(); i += 2)
+        convert_operands(*f.operands[i], *f.operands[i + 1]);
+
+    // one record for each variable, as check() makes them; a global has its own
+    std::map<std::pair<long, long>, Binding *> made;
+    for (size_t i = 0; i < f.bindings.size(); i++) {
+        const long *b = &bindings[3 * i];
+        int index = f.names[i]->get_index();
+        if (b[0] < 0)
+            *f.bindings[i] = NULL;
+        else if (b[0] == Binding::Global && index < (int) global_of.size() &&
+                 global_of[index] != NULL)
+            *f.bindings[i] = global_of[index];
+        else {
+            Binding *&record = made[std::make_pair(b[0], b[1])];
+            if (record == NULL)
+                record = new Binding((Binding::Kind) b[0], b[1], types[b[2]]);
+            *f.bindings[i] = record;
+        }
+    }
+    return true;
+}
+
+//
+// Dead declarations (-D).  A function or global is live if main names it,
+// or a live function does: a Call names a function and an Object or
+// Assign a global.  Names are taken as written, so a local that hides a
+// global keeps the global; that only ever keeps too much.  Only
+// declarations that made a function or a global are dropped; the others
+// are errors, which are reported as always.
+//
+struct DeadCount {
+    int functions, globals, nodes;
+};
+
+// the function decl declares, or -1 if it does not declare one
+static int function_of(Decl decl) {
+    const Signature *sig = find_signature(decl->getName());
+    if (!decl->isCallDecl() || sig == NULL)
+        return -1;
+    int f = sig - signatures.data();
+    return call_graph.functions[f] == decl ? f : -1;
+}
+
+// the slot of the global decl declares, or -1 if it does not declare one
+static int global_of_decl(Decl decl) {
+    int index = decl->getName()->get_index();
+    if (decl->isCallDecl() || index >= (int) global_of.size() || global_of[index] == NULL)
+        return -1;
+    int slot = global_of[index]->slot;
+    return global_decls[slot] == decl ? slot : -1;
+}
+
+// dropped[f] is set for each function f left out
+static Decls remove_dead(Decls decls, std::vector<CallDecl> &calls, DeadCount &dead,
+                         std::vector<bool> &dropped) {
+    const Signature *main_sig = find_signature(Main);
+    dead.functions = dead.globals = dead.nodes = 0;
+    if (main_sig == NULL)
+        return decls;
+
+    int n = call_graph.size();
+    std::vector<Fingerprint> refs(n);
+    run_parallel(n, jobs, [&](int f) { call_graph.functions[f]->fingerprint(refs[f]); });
+
+    std::vector<bool> live(n, false), live_global(global_decls.size(), false);
+    std::vector<int> work(1, main_sig - signatures.data());
+    live[work[0]] = true;
+    while (!work.empty()) {
+        int f = work.back();
+        work.pop_back();
+        for (Symbol name : refs[f].callees) {
+            const Signature *sig = find_signature(name);
+            if (sig != NULL && !live[sig - signatures.data()]) {
+                live[sig - signatures.data()] = true;
+                work.push_back(sig - signatures.data());
+            }
+        }
+        for (Symbol name : refs[f].names) {
+            int index = name->get_index();
+            if (index < (int) global_of.size() && global_of[index] != NULL)
+                live_global[global_of[index]->slot] = true;
+        }
+    }
+
+    Decls kept = nil_Decls();
+    for (int i = decls->first(); decls->more(i); i = decls->next(i)) {
+        Decl decl = decls->nth(i);
+        int f = function_of(decl), slot = global_of_decl(decl);
+        if (f >= 0 && !live[f]) {
+            dropped[f] = true;
+            dead.functions++;
+            dead.nodes += refs[f].nodes;
+        } else if (slot >= 0 && !live_global[slot]) {
+            Fingerprint global;
+            ((VariableDecl) decl)->fingerprint(global);
+            dead.globals++;
+            dead.nodes += global.nodes;
+        } else
+            kept = append_Decls(kept, single_Decls(decl));
+    }
+
+    if (!check_dead_decls) {
+        std::vector<CallDecl> live_calls;
+        for (CallDecl call : calls)
+            if (function_of(call) < 0 || live[function_of(call)])
+                live_calls.push_back(call);
+        calls.swap(live_calls);
+    }
+    return kept;
+}
+
+//
+// Forget the program checked last, so that another can be checked in the
+// same process.  The symbols stay in the string tables; the constants
+// are found there again.
+//
+void reset_semant() {
+    semant_errors = 0;
+    curr_decl = 0;
+    delete global_var_table;
+    global_var_table = new VariableEnvironment();
+    global_of.clear();
+    global_decls.clear();
+    signatures.clear();
+    param_types.clear();
+    signature_of.clear();
+    call_graph = CallGraph();
+}
+
+void Program_class::semant() {
+    initialize_constants();
+    install_calls(decls);
+    check_main();
+    install_globalVars(decls);
+
+    std::vector<CallDecl> calls;
+    for (int i = decls->first(); decls->more(i); i = decls->next(i)) {
+        Decl decl = decls->nth(i);
+        if (decl->isCallDecl())
+            calls.push_back((CallDecl) decl);
+    }
+    DeadCount dead;
+    std::vector<bool> dropped(call_graph.size(), false);
+    if (remove_dead_decls)
+        decls = remove_dead(decls, calls, dead, dropped);
+    check_calls(calls, dropped);
+    
+    if (semant_errors > 0)
+        diagnostics.halt("Compilation halted due to static semantic errors.");
+    if (remove_dead_decls)
+        cerr << "Removed " << dead.functions << " functions and " << dead.globals
+             << " globals not reached from main, " << dead.nodes << " AST nodes.\n";
+
+    if (cgen_optimize) {
+        Folder folder(Int);
+        for (CallDecl call : calls)
+            call->fold(folder);
+        cerr << "Folded " << folder.folded + folder.simplified << " operators: "
+             << folder.folded << " to constants, " << folder.simplified
+             << " by algebraic identities.\n";
+    }
+}
+
+
+
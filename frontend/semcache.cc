@@ -0,0 +1,229 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <time.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "semcache.h"
+
+static const char magic[] = "seal-semant-cache";
+
+// bytes this process has stored since cache_trim() last looked
+static std::atomic<long long> stored_bytes(0);
+
+void CacheHasher::add(const char *p, size_t n)
+{
+    add(n);
+    for (; n >= 8; p += 8, n -= 8) {
+        unsigned long long w;
+        memcpy(&w, p, 8);
+        add(w);
+    }
+    if (n > 0) {
+        unsigned long long w = 0;
+        memcpy(&w, p, n);
+        add(w);
+    }
+}
+
+CacheKey CacheHasher::key() const
+{
+    unsigned long long k = a;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 29;
+    CacheKey r = { k, b };
+    return r;
+}
+
+//
+// The hash of the running executable, or failing that of the time this
+// file was compiled.
+//
+static CacheKey hash_executable()
+{
+    CacheHasher exe;
+    int fd = open("/proc/self/exe", O_RDONLY);
+    char buf[1 << 16];
+    ssize_t n, total = 0;
+    while (fd >= 0 && (n = read(fd, buf, sizeof buf)) > 0) {
+        exe.add(buf, n);
+        total += n;
+    }
+    if (fd >= 0)
+        close(fd);
+    if (total == 0)
+        exe.add(__DATE__ " " __TIME__, sizeof __DATE__ " " __TIME__);
+    return exe.key();
+}
+
+CacheKey build_id()
+{
+    static const CacheKey build = hash_executable();
+    return build;
+}
+
+static unsigned long long payload_sum(const std::string &s)
+{
+    CacheHasher h;
+    h.add(s.data(), s.size());
+    return h.key().key;
+}
+
+static std::string entry_path(const char *dir, const CacheKey &k)
+{
+    char name[24];
+    snprintf(name, sizeof name, "%016llx", k.key);
+    return std::string(dir) + "/" + name;
+}
+
+bool cache_load(const char *dir, const CacheKey &k, std::string &payload)
+{
+    std::string path = entry_path(dir, k);
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == NULL)
+        return false;
+
+    std::string data;
+    char buf[8192];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof buf, fp)) > 0)
+        data.append(buf, n);
+    fclose(fp);
+
+    int version, header;
+    unsigned long long key, check, sum;
+    size_t length;
+    char word[sizeof magic];
+    if (sscanf(data.c_str(), "%17s %d %llx %llx %zu %llx%n",
+               word, &version, &key, &check, &length, &sum, &header) != 6)
+        return false;
+    if (std::string(word) != magic || version != SEMANT_CACHE_VERSION ||
+        key != k.key || check != k.check)
+        return false;
+    if ((size_t) header + 1 + length != data.size() || data[header] != '\n')
+        return false;
+
+    std::string rest = data.substr(header + 1);
+    if (payload_sum(rest) != sum)
+        return false;
+    payload.swap(rest);
+    utimensat(AT_FDCWD, path.c_str(), NULL, 0);
+    return true;
+}
+
+void cache_store(const char *dir, const CacheKey &k, const std::string &payload)
+{
+    static std::atomic<int> serial(0);
+
+    mkdir(dir, 0777);
+    std::string path = entry_path(dir, k);
+    std::string temp = path + ".tmp." + std::to_string(getpid()) + "." +
+        std::to_string(serial++);
+
+    FILE *fp = fopen(temp.c_str(), "wb");
+    if (fp == NULL)
+        return;
+    fprintf(fp, "%s %d\n%016llx %016llx %zu %016llx\n", magic,
+            SEMANT_CACHE_VERSION, k.key, k.check, payload.size(), payload_sum(payload));
+    bool written = fwrite(payload.data(), 1, payload.size(), fp) == payload.size();
+    long long size = ftell(fp);
+    if (fclose(fp) != 0 || !written || rename(temp.c_str(), path.c_str()) != 0)
+        unlink(temp.c_str());
+    else
+        stored_bytes += size;
+}
+
+//
+// Whether name is one the cache writes: an entry, 16 hex digits, or the
+// temporary file of one, the entry's name then ".tmp.".  Nothing else in
+// the directory is ever removed.
+//
+static bool is_cache_file(const char *name)
+{
+    for (int i = 0; i < 16; i++)
+        if (!isxdigit((unsigned char) name[i]))
+            return false;
+    return name[16] == '\0' || strncmp(name + 16, ".tmp.", 5) == 0;
+}
+
+//
+// Removes the least recently used entries until dir holds at most
+// max_bytes of them; returns the bytes left, or -1 if dir cannot be read.
+//
+static long long evict(const char *dir, long long max_bytes)
+{
+    DIR *d = opendir(dir);
+    if (d == NULL)
+        return -1;
+
+    // (last use, size, name) of every entry; temporary files left by a
+    // compiler that died count as used an hour after they were written
+    std::vector<std::pair<std::pair<time_t, long long>, std::string> > files;
+    long long total = 0;
+    struct dirent *e;
+    while ((e = readdir(d)) != NULL) {
+        std::string path = std::string(dir) + "/" + e->d_name;
+        struct stat st;
+        if (!is_cache_file(e->d_name) || stat(path.c_str(), &st) != 0 ||
+            !S_ISREG(st.st_mode))
+            continue;
+        time_t used = st.st_mtime;
+        if (strstr(e->d_name, ".tmp.") != NULL)
+            used += 3600;
+        files.push_back(std::make_pair(std::make_pair(used, (long long) st.st_size), path));
+        total += st.st_size;
+    }
+    closedir(d);
+    if (total <= max_bytes)
+        return total;
+
+    std::sort(files.begin(), files.end());
+    time_t now = time(NULL);
+    for (size_t i = 0; i < files.size() && total > max_bytes; i++) {
+        if (strstr(files[i].second.c_str(), ".tmp.") != NULL && files[i].first.first > now)
+            continue;       // still being written
+        if (unlink(files[i].second.c_str()) == 0)
+            total -= files[i].first.second;
+    }
+    return total;
+}
+
+//
+// The directory is read the first time, and then only when what this
+// process stored since would take it past max_bytes, or every
+// trim_every calls, to see what other compilers sharing it stored.
+//
+void cache_trim(const char *dir, long long max_bytes)
+{
+    static const int trim_every = 64;
+    static std::mutex lock;
+    static std::string last_dir;
+    static long long known = -1;        // bytes in last_dir when last read
+    static int calls = 0;
+
+    std::lock_guard<std::mutex> hold(lock);
+    long long added = stored_bytes.exchange(0);
+    if (last_dir != dir) {
+        last_dir = dir;
+        known = -1;
+    }
+    if (known >= 0 && known + added <= max_bytes && ++calls % trim_every != 0) {
+        known += added;
+        return;
+    }
+    known = evict(dir, max_bytes);
+    calls = 0;
+}
@@ -0,0 +1,84 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _SEMCACHE_H_
+#define _SEMCACHE_H_
+
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Semantic result cache
+//
+//  A directory with one file per checked function, named by a hash of
+//  everything the check of the function read.  A file is
+//
+//      seal-semant-cache <version>
+//      <key> <check> <length> <sum>
+//      <length bytes of payload>
+//
+//  key is the name of the file, check a second hash of the same input and
+//  sum a hash of the payload; a file that does not match all of them, or
+//  is of another version, is taken as missing.  Files are written under a
+//  temporary name and renamed into place, so that compilers sharing the
+//  directory only ever see whole files.  Two compilers storing the same
+//  entry store the same bytes, and the last rename wins.
+//
+//  Loading an entry touches its file, so the oldest modification times
+//  are those least recently used; cache_trim() removes entries from those
+//  on until the directory holds no more than the bytes given.  It only
+//  ever removes names the cache writes, and reads the directory only when
+//  what this process stored may have taken it past the limit, or every
+//  so many calls.  Another compiler may be reading a file being removed:
+//  it keeps what it opened.
+//  outcache.h keeps whole outputs in the same directory and form.
+//
+//  Bump SEMANT_CACHE_VERSION when the payload written by semant.cc
+//  changes its form.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#define SEMANT_CACHE_VERSION 1
+
+struct CacheKey {
+    unsigned long long key, check;
+};
+
+//
+// Computes the two hashes of a key together, from numbers and bytes
+// added one after another; the two are unrelated, so that a file whose
+// name collides is still caught by the other.
+//
+class CacheHasher {
+    unsigned long long a, b;
+public:
+    CacheHasher() : a(0xcbf29ce484222325ULL), b(0x9e3779b97f4a7c15ULL) { }
+
+    void add(unsigned long long w)
+    {
+        a = (a ^ w) * 0x100000001b3ULL;
+        a ^= a >> 32;
+        b = (b + w) * 0xff51afd7ed558ccdULL;
+        b ^= b >> 29;
+    }
+    // the length, then the bytes eight at a time
+    void add(const char *p, size_t n);
+    CacheKey key() const;
+};
+
+// a hash of the running compiler's executable, to be part of every key, so
+// that no build reads what another stored
+CacheKey build_id();
+
+// the payload stored under k, or false
+bool cache_load(const char *dir, const CacheKey &k, std::string &payload);
+// store payload under k, creating dir if needed; failures are ignored
+void cache_store(const char *dir, const CacheKey &k, const std::string &payload);
+// remove the least recently used entries until dir takes at most max_bytes
+void cache_trim(const char *dir, long long max_bytes);
+
+#endif
@@ -0,0 +1,228 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include "tree.h"
+#include "seal-decl.h"
+#include "seal-stmt.h"
+#include "seal-expr.h"
+
+//////////////////////////////////////////////////////////////////
+//
+//  shiftlines.cc
+//
+//  shift_lines(delta) adds delta to the line number of a node and of
+//  all the nodes below it.  seal_reparse() (seal-rdparse.cc)
+//  uses it to move the tree of a declaration that did not change to
+//  the line where the declaration now starts.
+//
+//  Nodes without children use tree_node::shift_lines; lists shift
+//  their elements (tree.h).  The other kinds of node are below.
+//
+//////////////////////////////////////////////////////////////////
+
+void Program_class::shift_lines(int delta)
+{
+   line_number += delta;
+   decls->shift_lines(delta);
+}
+
+void VariableDecl_class::shift_lines(int delta)
+{
+   line_number += delta;
+   variable->shift_lines(delta);
+}
+
+void CallDecl_class::shift_lines(int delta)
+{
+   line_number += delta;
+   paras->shift_lines(delta);
+   getBody()->shift_lines(delta);
+}
+
+void StmtBlock_class::shift_lines(int delta)
+{
+   line_number += delta;
+   vars->shift_lines(delta);
+   stmts->shift_lines(delta);
+}
+
+void IfStmt_class::shift_lines(int delta)
+{
+   line_number += delta;
+   condition->shift_lines(delta);
+   thenexpr->shift_lines(delta);
+   elseexpr->shift_lines(delta);
+}
+
+void WhileStmt_class::shift_lines(int delta)
+{
+   line_number += delta;
+   condition->shift_lines(delta);
+   body->shift_lines(delta);
+}
+
+void ForStmt_class::shift_lines(int delta)
+{
+   line_number += delta;
+   initexpr->shift_lines(delta);
+   condition->shift_lines(delta);
+   loopact->shift_lines(delta);
+   body->shift_lines(delta);
+}
+
+void ReturnStmt_class::shift_lines(int delta)
+{
+   line_number += delta;
+   value->shift_lines(delta);
+}
+
+void Assign_class::shift_lines(int delta)
+{
+   line_number += delta;
+   value->shift_lines(delta);
+}
+
+void Add_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Minus_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Multi_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Divide_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Mod_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Lt_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Le_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Equ_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Neq_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Ge_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Gt_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void And_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Or_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Xor_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Bitand_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Bitor_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+   e2->shift_lines(delta);
+}
+
+void Neg_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+}
+
+void Not_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+}
+
+void Bitnot_class::shift_lines(int delta)
+{
+   line_number += delta;
+   e1->shift_lines(delta);
+}
+
+void Call_class::shift_lines(int delta)
+{
+   line_number += delta;
+   actuals->shift_lines(delta);
+}
+
+void Actual_class::shift_lines(int delta)
+{
+   line_number += delta;
+   expr->shift_lines(delta);
+}
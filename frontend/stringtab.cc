@@ -68,7 +68,7 @@ Symbol copy_Symbol(const Symbol s)
 
 void dump_Symbol(ostream& s, int n, Symbol sym)
 {
-  s << pad(n) << sym << endl;
+  s << pad(n) << sym << "\n";
 }
 
 StringEntry::StringEntry(char *s, int l, int i) : Entry(s,l,i) { }
@@ -11,6 +11,7 @@
 
 #include <assert.h>
 #include <string.h>
+#include <mutex>
 #include "list.h"    // list template
 #include "seal-io.h"
 
@@ -45,6 +46,7 @@ public:
   // Return the str and len components of the Entry.
   char *get_string() const;
   int get_len() const;
+  int get_index() const                     { return index; }
 };
 
 //
@@ -102,6 +104,8 @@ class StringTable
 protected:
    List<Elem> *tbl;   // a string table is a list
    int index;         // the current index
+   std::mutex lock;   // held while tbl is searched or added to, so that
+                      // threads parsing files of their own share the table
 public:
    StringTable(): tbl((List<Elem> *) NULL), index(0) { }   // an empty table
    // The following methods each add a string to the string table.  
@@ -5,12 +5,12 @@
 #include "copyright.h"
 
 #include "seal-io.h"
-#define MAXSIZE 1000000
-#define min(a,b) (a > b ? b : a)
-
 #include "stringtab.h"
 #include <stdio.h>
 
+#define MAXSIZE 1000000
+#define min(a,b) (a > b ? b : a)
+
 //
 // A string table is implemented a linked list of Entrys.  Each Entry
 // in the list has a unique string.
@@ -32,6 +32,7 @@ template <class Elem>
 Elem *StringTable<Elem>::add_string(char *s, int maxchars)
 {
   int len = min((int) strlen(s),maxchars);
+  std::lock_guard<std::mutex> held(lock);
   for(List<Elem> *l = tbl; l; l = l->tl())
     if (l->hd()->equal_string(s,len))
       return l->hd();
@@ -50,6 +51,7 @@ template <class Elem>
 Elem *StringTable<Elem>::lookup_string(char *s)
 {
   int len = strlen(s);
+  std::lock_guard<std::mutex> held(lock);
   for(List<Elem> *l = tbl; l; l = l->tl())
     if (l->hd()->equal_string(s,len))
       return l->hd();
@@ -64,6 +66,7 @@ Elem *StringTable<Elem>::lookup_string(char *s)
 template <class Elem>
 Elem *StringTable<Elem>::lookup(int ind)
 {
+  std::lock_guard<std::mutex> held(lock);
   for(List<Elem> *l = tbl; l; l = l->tl())
     if (l->hd()->equal_index(ind))
       return l->hd();
@@ -77,7 +80,7 @@ Elem *StringTable<Elem>::lookup(int ind)
 template <class Elem>
 Elem *StringTable<Elem>::add_int(long i)
 {
-  static char *buf = new char[20];
+  char buf[20];
   snprintf(buf, 20, "%ld", i);
   return add_string(buf);
 }
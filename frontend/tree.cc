@@ -15,9 +15,6 @@
 
 #include "tree.h"
 
-/* line number to assign to the current node being constructed */
-int node_lineno = 1;
-
 ///////////////////////////////////////////////////////////////////////////
 //
 // tree_node::tree_node
@@ -27,7 +24,12 @@ int node_lineno = 1;
 ///////////////////////////////////////////////////////////////////////////
 tree_node::tree_node()
 {
-    line_number = node_lineno;
+    line_number = 0;
+}
+
+tree_node::tree_node(int line)
+{
+    line_number = line;
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,7 @@
 
 #include "stringtab.h"
 #include "seal-io.h"
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////
 //
@@ -25,15 +26,19 @@
 //   All APS nodes are derived from tree_node.  There is a
 //   protected field:
 //       int line_number     line in the source file from which this node came;
-//                           this is read from a global variable when the
-//                           node is created.
+//                           this is passed to the constructor of every
+//                           AST node, so building a tree touches no
+//                           global state.
 //      
 //
 //
 //   The public methods are:
+//       tree_node(int line)
+//         builds a new tree_node coming from source line "line".
+//
 //       tree_node()
-//         builds a new tree_node.  The type field is NULL, the
-//         line_number is set to the value of the global yylineno.
+//         builds a node without a source position (line 0); used by the
+//         list nodes, whose line numbers are never reported.
 //
 //       void dump(ostream& s,int n); 
 //         dump is a pretty printer for tree nodes.  The ostream argument
@@ -47,6 +52,11 @@
 //           sets the line number and type of "this" to the values in
 //           the argument tree_node.  Returns "this".
 //
+//       void shift_lines(int delta)
+//           adds delta to the line number of this node and of every node
+//           below it (see shiftlines.cc); used to move a subtree that is
+//           reused from an earlier parse to its new place in the file.
+//
 //
 ////////////////////////////////////////////////////////////////////////////
 class tree_node {
@@ -54,11 +64,13 @@ protected:
     int line_number;            // stash the line number when node is made
 public:
     tree_node();
+    tree_node(int line);
     virtual tree_node *copy() = 0;
     virtual ~tree_node() { }
     virtual void dump(ostream& stream, int n) = 0;
     int get_line_number();
     tree_node *set(tree_node *);
+    virtual void shift_lines(int delta) { line_number += delta; }
 };
 
 ///////////////////////////////////////////////////////////////////
@@ -93,6 +105,11 @@ public:
 //     int len()
 //     returns the length of the list
 //
+//     void collect(std::vector<Elem> &v)
+//     appends the elements of the list to v, in order, in one pass over
+//     the list.  Stepping through an append_node chain with nth() costs
+//     time in the length of the chain for every element.
+//
 //     nth_length(int n, int &len);
 //     Returns the nth element of the list or NULL if there are not n elements.
 //     "len" is set to the length of the list.  This method is used internally
@@ -123,10 +140,16 @@ public:
     int next(int n)  { return n + 1; }
     int more(int n)  { return (n < len()); }
 
+    void shift_lines(int delta) {
+        for (int i = first(); more(i); i = next(i))
+            nth(i)->shift_lines(delta);
+    }
+
     virtual list_node<Elem> *copy_list() = 0;
     virtual ~list_node() { }
     virtual int len() = 0;
     virtual Elem nth_length(int n, int &len) = 0;
+    virtual void collect(std::vector<Elem> &v) = 0;
 
     static list_node<Elem> *nil();
     static list_node<Elem> *single(Elem);
@@ -142,6 +165,7 @@ public:
     list_node<Elem> *copy_list();
     int len();
     Elem nth_length(int n, int &len);
+    void collect(std::vector<Elem> &) { }
     void dump(ostream& stream, int n);
 };
 
@@ -154,6 +178,7 @@ public:
     list_node<Elem> *copy_list();
     int len();
     Elem nth_length(int n, int &len);
+    void collect(std::vector<Elem> &v) { v.push_back(elem); }
     void dump(ostream& stream, int n);
 };
 
@@ -170,6 +195,7 @@ public:
     int len();
     Elem nth(int n);
     Elem nth_length(int n, int &len);
+    void collect(std::vector<Elem> &v) { some->collect(v); rest->collect(v); }
     void dump(ostream& stream, int n);
 };
 
@@ -127,55 +127,60 @@ char *seal_token_to_string(int tok)
   }
 }
 
-void print_seal_token(int tok)
+void print_seal_token(ostream& out, int tok)
 {
 
-  cerr << seal_token_to_string(tok);
+  out << seal_token_to_string(tok);
 
   switch (tok) {
   case (CONST_STRING):
-    cerr << " = ";
-    cerr << " \"";
-    print_escaped_string(cerr, seal_yylval.symbol->get_string());
-    cerr << "\"";
+    out << " = ";
+    out << " \"";
+    print_escaped_string(out, seal_yylval.symbol->get_string());
+    out << "\"";
 #ifdef CHECK_TABLES
     stringtable.lookup_string(seal_yylval.symbol->get_string());
 #endif
     break;
   case (CONST_INT):
-    cerr << " = " << seal_yylval.symbol;
+    out << " = " << seal_yylval.symbol;
 #ifdef CHECK_TABLES
     inttable.lookup_string(seal_yylval.symbol->get_string());
 #endif
     break;
   case (CONST_FLOAT):
-    cerr << " = " << seal_yylval.symbol;
+    out << " = " << seal_yylval.symbol;
 #ifdef CHECK_TABLES
     floattable.lookup_string(seal_yylval.symbol->get_string());
 #endif
     break;
   case (CONST_BOOL):
-    cerr << (seal_yylval.boolean ? " = true" : " = false");
+    out << (seal_yylval.boolean ? " = true" : " = false");
     break;
   case (OBJECTID):
-    cerr << " = " << seal_yylval.symbol;
+    out << " = " << seal_yylval.symbol;
 #ifdef CHECK_TABLES
     idtable.lookup_string(seal_yylval.symbol->get_string());
 #endif
     break;
   case (TYPEID):
-    cerr << " = " << seal_yylval.symbol;
+    out << " = " << seal_yylval.symbol;
 #ifdef CHECK_TABLES
     idtable.lookup_string(seal_yylval.symbol->get_string());
 #endif
     break;
   case (ERROR): 
-    cerr << " = ";
-    print_escaped_string(cerr, seal_yylval.error_msg);
+    out << " = ";
+    print_escaped_string(out, seal_yylval.error_msg);
     break;
   }
 }
 
+void print_seal_token(int tok)
+{
+  print_seal_token(cerr, tok);
+}
+
 // dump the token in format readable by the sceond phase token lexer
 void dump_seal_token(ostream& out, int lineno, int token, YYSTYPE yylval)
 {
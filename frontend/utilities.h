@@ -12,6 +12,7 @@
 
 extern char *seal_token_to_string(int tok);
 extern void print_seal_token(int tok);
+extern void print_seal_token(ostream& out, int tok);
 extern void fatal_error(char *);
 extern void print_escaped_string(ostream& str, const char *s);
 extern char *pad(int);
@@ -0,0 +1,83 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <thread>
+#include <mutex>
+#include <vector>
+#include "workpool.h"
+
+//
+// The indices still to be done by one thread: [lo, hi).  The owner takes
+// from lo, thieves from hi.
+//
+struct WorkShare {
+    std::mutex lock;
+    int lo, hi;
+
+    bool take_front(int &i)
+    {
+        std::lock_guard<std::mutex> g(lock);
+        if (lo >= hi)
+            return false;
+        i = lo++;
+        return true;
+    }
+
+    bool take_back(int &i)
+    {
+        std::lock_guard<std::mutex> g(lock);
+        if (lo >= hi)
+            return false;
+        i = --hi;
+        return true;
+    }
+};
+
+static void worker(std::vector<WorkShare> &shares, int self,
+                   const std::function<void(int)> &work)
+{
+    int n = shares.size(), i;
+
+    while (shares[self].take_front(i))
+        work(i);
+    for (int k = 1; k < n; k++) {
+        WorkShare &victim = shares[(self + k) % n];
+        while (victim.take_back(i))
+            work(i);
+    }
+}
+
+int parallel_threads(int n, int jobs)
+{
+    if (jobs <= 0)
+        jobs = std::thread::hardware_concurrency();
+    if (jobs > n)
+        jobs = n;
+    return jobs < 1 ? 1 : jobs;
+}
+
+void run_parallel(int n, int jobs, const std::function<void(int)> &work)
+{
+    jobs = parallel_threads(n, jobs);
+    if (jobs <= 1) {
+        for (int i = 0; i < n; i++)
+            work(i);
+        return;
+    }
+
+    std::vector<WorkShare> shares(jobs);
+    for (int t = 0; t < jobs; t++) {
+        shares[t].lo = (long long) n * t / jobs;
+        shares[t].hi = (long long) n * (t + 1) / jobs;
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < jobs; t++)
+        threads.push_back(std::thread(worker, std::ref(shares), t, std::cref(work)));
+    worker(shares, 0, work);
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+}
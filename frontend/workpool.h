@@ -0,0 +1,29 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _WORKPOOL_H_
+#define _WORKPOOL_H_
+
+#include <functional>
+
+//
+// run_parallel(n, jobs, work) calls work(i) once for every i in [0, n), on
+// up to jobs threads (jobs <= 0: one per CPU), and returns when all calls
+// have returned.  Each thread starts with a contiguous share of the
+// indices, takes them from the front, and when it runs out steals from
+// the back of the share of another thread.  With one thread, or a single
+// index, the calls are made in order on the calling thread.
+//
+void run_parallel(int n, int jobs, const std::function<void(int)> &work);
+
+//
+// The number of threads run_parallel(n, jobs, ...) uses; thread t starts
+// with the indices [n * t / threads, n * (t + 1) / threads).
+//
+int parallel_threads(int n, int jobs);
+
+#endif
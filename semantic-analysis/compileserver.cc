@@ -0,0 +1,371 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "seal-io.h"
+#include "compileserver.h"
+
+const char *default_socket()
+{
+    static std::string path;
+    if (!path.empty())
+        return path.c_str();
+    const char *env = getenv("SEALC_SOCKET");
+    if (env != NULL && *env != '\0')
+        return (path = env).c_str();
+    env = getenv("XDG_RUNTIME_DIR");
+    if (env != NULL && *env != '\0')
+        return (path = std::string(env) + "/sealc.sock").c_str();
+
+    // /tmp is everyone's: the socket goes in a directory only we can enter
+    std::string dir = "/tmp/sealc-" + std::to_string(getuid());
+    struct stat st;
+    mkdir(dir.c_str(), 0700);
+    if (lstat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode) ||
+        st.st_uid != getuid() || (st.st_mode & 077) != 0) {
+        cerr << dir << " is not a directory private to this user;"
+             << " set SEALC_SOCKET or use --socket=" << endl;
+        return NULL;
+    }
+    return (path = dir + "/sealc.sock").c_str();
+}
+
+//
+// Messages
+//
+
+static void put_u32(std::string &s, unsigned v)
+{
+    for (int i = 0; i < 4; i++)
+        s += (char) (v >> (8 * i) & 0xff);
+}
+
+static unsigned get_u32(const char *p)
+{
+    unsigned v = 0;
+    for (int i = 0; i < 4; i++)
+        v |= (unsigned) (unsigned char) p[i] << (8 * i);
+    return v;
+}
+
+static void put_record(std::string &msg, char tag, const std::string &data)
+{
+    msg += tag;
+    put_u32(msg, data.size());
+    msg += data;
+}
+
+// the next record of msg from pos; false at the end or if it is cut short
+static bool next_record(const std::string &msg, size_t &pos, char &tag, std::string &data)
+{
+    if (pos + 5 > msg.size())
+        return false;
+    size_t len = get_u32(msg.data() + pos + 1);
+    if (pos + 5 + len > msg.size())
+        return false;
+    tag = msg[pos];
+    data.assign(msg, pos + 5, len);
+    pos += 5 + len;
+    return true;
+}
+
+static bool write_all(int fd, const char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t w = write(fd, buf, len);
+        if (w < 0 && errno == EINTR)
+            continue;
+        if (w <= 0)
+            return false;
+        buf += w;
+        len -= w;
+    }
+    return true;
+}
+
+static bool read_all(int fd, char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t r = read(fd, buf, len);
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r <= 0)
+            return false;
+        buf += r;
+        len -= r;
+    }
+    return true;
+}
+
+static bool send_message(int fd, const std::string &msg)
+{
+    std::string len;
+    put_u32(len, msg.size());
+    return write_all(fd, len.data(), 4) && write_all(fd, msg.data(), msg.size());
+}
+
+static bool recv_message(int fd, std::string &msg)
+{
+    char len[4];
+    if (!read_all(fd, len, 4))
+        return false;
+    msg.resize(get_u32(len));
+    return read_all(fd, &msg[0], msg.size());
+}
+
+// appends what is left to read from fd to s
+static void read_rest(int fd, std::string &s)
+{
+    char buf[1 << 16];
+    ssize_t r;
+    while ((r = read(fd, buf, sizeof buf)) > 0 || (r < 0 && errno == EINTR))
+        if (r > 0)
+            s.append(buf, r);
+}
+
+//
+// Server
+//
+
+static const char *serving_path;
+
+// what the connection's request writes, sent back when it exits
+static int reply_to = -1;
+static FILE *reply_out, *reply_err;
+
+static void stop_serving(int sig)
+{
+    unlink(serving_path);
+    _exit(0);
+}
+
+static void send_reply(int status, void *)
+{
+    cout.flush();
+    cerr.flush();
+    fflush(stdout);
+    fflush(stderr);
+    std::string reply, text;
+    lseek(fileno(reply_out), 0, SEEK_SET);
+    read_rest(fileno(reply_out), text);
+    put_record(reply, 'O', text);
+    text.clear();
+    lseek(fileno(reply_err), 0, SEEK_SET);
+    read_rest(fileno(reply_err), text);
+    put_record(reply, 'E', text);
+    text.clear();
+    put_u32(text, status & 0xff);
+    put_record(reply, 'X', text);
+    send_message(reply_to, reply);
+}
+
+//
+// Runs the request on connection c in this process, the one forked for
+// the connection, with standard input, output and error in temporary
+// files.  What it wrote is sent back when it exits, which it also may do
+// from within run(), as on a usage error.
+//
+static void handle(int c, int (*run)(int argc, char *argv[]))
+{
+    std::string request, data, cwd = "/";
+    std::vector<std::string> args;
+    FILE *in = NULL;
+    char tag;
+    if (!recv_message(c, request))
+        return;
+    for (size_t pos = 0; next_record(request, pos, tag, data); )
+        switch (tag) {
+        case 'C':
+            cwd = data;
+            break;
+        case 'A':
+            args.push_back(data);
+            break;
+        case 'S':
+            if ((in = tmpfile()) != NULL) {
+                write_all(fileno(in), data.data(), data.size());
+                lseek(fileno(in), 0, SEEK_SET);
+            }
+            break;
+        }
+
+    reply_out = tmpfile();
+    reply_err = tmpfile();
+    if (args.empty() || reply_out == NULL || reply_err == NULL)
+        return;
+    reply_to = c;
+    on_exit(send_reply, NULL);
+    dup2(fileno(reply_out), 1);
+    dup2(fileno(reply_err), 2);
+    if (in != NULL)
+        dup2(fileno(in), 0);
+    else
+        close(0);
+    if (chdir(cwd.c_str()) != 0) {
+        cerr << "Could not change to directory " << cwd << endl;
+        exit(1);
+    }
+    std::vector<char *> argv;
+    for (size_t i = 0; i < args.size(); i++)
+        argv.push_back(&args[i][0]);
+    argv.push_back(NULL);
+    exit(run(args.size(), &argv[0]));
+}
+
+int serve(const char *socket_path, int jobs, int (*run)(int argc, char *argv[]))
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof addr.sun_path) {
+        cerr << "Socket path too long: " << socket_path << endl;
+        return 1;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    // only this user may connect: a request compiles with our permissions
+    int s = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socket_path);
+    mode_t mask = umask(077);
+    bool bound = s >= 0 && bind(s, (struct sockaddr *) &addr, sizeof addr) == 0;
+    umask(mask);
+    if (!bound || listen(s, 64) != 0) {
+        cerr << "Could not listen on " << socket_path << ": " << strerror(errno) << endl;
+        return 1;
+    }
+    serving_path = socket_path;
+    signal(SIGINT, stop_serving);
+    signal(SIGTERM, stop_serving);
+    signal(SIGPIPE, SIG_IGN);
+    if (jobs <= 0)
+        jobs = std::thread::hardware_concurrency();
+    if (jobs <= 0)
+        jobs = 1;
+    cerr << "sealc: serving on " << socket_path << endl;
+
+    int running = 0;
+    for (;;) {
+        while (running > 0 && waitpid(-1, NULL, WNOHANG) > 0)
+            running--;
+        if (running >= jobs) {
+            if (waitpid(-1, NULL, 0) > 0)
+                running--;
+            continue;
+        }
+        int c = accept(s, NULL, NULL);
+        if (c < 0) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            cerr << "accept: " << strerror(errno) << endl;
+            unlink(socket_path);
+            return 1;
+        }
+        pid_t pid = fork();
+        if (pid == 0) {
+            close(s);
+            signal(SIGINT, SIG_DFL);
+            signal(SIGTERM, SIG_DFL);
+            handle(c, run);
+            _exit(1);
+        }
+        if (pid > 0)
+            running++;
+        close(c);
+    }
+}
+
+//
+// Client
+//
+
+int request_compile(const char *socket_path, int argc, char *argv[])
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof addr.sun_path)
+        return -1;
+    strcpy(addr.sun_path, socket_path);
+
+    // whoever listens gets our sources and arguments, and we print what
+    // it says: it has to be a server of this user's
+    struct stat st;
+    if (lstat(socket_path, &st) != 0)
+        return -1;
+    if (!S_ISSOCK(st.st_mode) || st.st_uid != getuid()) {
+        cerr << argv[0] << ": " << socket_path
+             << " is not a socket of this user's; not connecting" << endl;
+        return 1;
+    }
+    int s = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s < 0 || connect(s, (struct sockaddr *) &addr, sizeof addr) != 0) {
+        if (s >= 0)
+            close(s);
+        return -1;
+    }
+    struct ucred peer;
+    socklen_t len = sizeof peer;
+    if (getsockopt(s, SOL_SOCKET, SO_PEERCRED, &peer, &len) != 0 ||
+        peer.uid != getuid()) {
+        close(s);
+        cerr << argv[0] << ": the server at " << socket_path
+             << " is not this user's; not connecting" << endl;
+        return 1;
+    }
+
+    std::string request, source;
+    std::vector<char> cwd(4096);
+    if (getcwd(&cwd[0], cwd.size()) != NULL)
+        put_record(request, 'C', &cwd[0]);
+    bool reads_stdin = false;
+    for (int i = 0; i < argc; i++) {
+        put_record(request, 'A', argv[i]);
+        if (i > 0 && strcmp(argv[i], "-") == 0)
+            reads_stdin = true;
+    }
+    if (reads_stdin) {
+        read_rest(0, source);
+        put_record(request, 'S', source);
+    }
+
+    std::string reply, data;
+    signal(SIGPIPE, SIG_IGN);
+    if (!send_message(s, request) || !recv_message(s, reply)) {
+        close(s);
+        cerr << argv[0] << ": lost the connection to the compile server" << endl;
+        return 1;
+    }
+    close(s);
+
+    int status = 1;
+    char tag;
+    for (size_t pos = 0; next_record(reply, pos, tag, data); )
+        switch (tag) {
+        case 'O':
+            write_all(1, data.data(), data.size());
+            break;
+        case 'E':
+            write_all(2, data.data(), data.size());
+            break;
+        case 'X':
+            if (data.size() == 4)
+                status = get_u32(data.data());
+            break;
+        }
+    return status;
+}
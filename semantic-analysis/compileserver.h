@@ -0,0 +1,53 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _COMPILESERVER_H_
+#define _COMPILESERVER_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Compile server
+//
+//  sealc --server listens on a Unix socket and compiles for sealc-client,
+//  which takes the same arguments as sealc and exits with the status
+//  sealc would have.  A connection carries one request and its reply,
+//  each a message: a 4-byte little-endian length and then records of a
+//  tag byte, a 4-byte little-endian length and that many bytes.
+//
+//      request     'C' directory to run in, 'A' an argument (one record
+//                  for each, in order, argv[0] first), 'S' the source
+//                  to read as standard input (file "-"), if any
+//      reply       'O' standard output, 'E' standard error, 'X' the exit
+//                  status as 4 bytes
+//
+//  The server has set up the front end once; each connection is served
+//  by a process forked from it, which runs the request, so it starts
+//  warm and all the memory it took is given back when it is done.  At
+//  most jobs requests run at a time (0: one per CPU).
+//
+//  A request compiles with the permissions of the server, so the socket
+//  is made for its user alone, and the client only talks to a server of
+//  its own user: the owner of the socket, and of the process behind it,
+//  is checked before anything is sent.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// $SEALC_SOCKET, else sealc.sock in $XDG_RUNTIME_DIR, else in
+// /tmp/sealc-<uid>, which is made private to the user.  NULL, after
+// saying why, if that directory is someone else's or others may enter it.
+const char *default_socket();
+
+// Serves requests on socket_path until killed, running each as run(argc,
+// argv).  Returns only if the socket cannot be set up.
+int serve(const char *socket_path, int jobs, int (*run)(int argc, char *argv[]));
+
+// Sends argv to the server and writes out its reply.  Returns the exit
+// status, or -1 if there is no server at socket_path; 1, after saying
+// why, if the socket or the server is another user's.
+int request_compile(const char *socket_path, int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,190 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "seal-decl.h"
+#include "seal-expr.h"
+#include "seal-stmt.h"
+#include "diagnostics.h"
+#include "callgraph.h"
+#include "dumpwriter.h"
+#include "dumpformat.h"
+#include "outcache.h"
+#include "parse_context.h"
+#include "frontend.h"
+
+extern char *call_graph_file;
+extern char *cache_dir;
+extern int dump_format;
+extern thread_local FILE *fin;          // defined by the driver
+extern thread_local char *curr_filename;
+extern int yylex_destroy(void);         // seal-lex.cc
+
+Program parse_phase()
+{
+  ParseContext ctx(curr_filename);
+  curr_lineno = 1;
+  semant_yyparse(&ctx);
+  diagnostics.check();
+  if (ctx.omerrs != 0 || ctx.ast_root == NULL) {
+    diagnostics.flush();
+    cout << "syntax analyze failed. Please make sure syntax parser passed." << endl;
+    return NULL;
+  }
+  return ctx.ast_root;
+}
+
+void semant_phase(Program program)
+{
+  program->semant();
+  diagnostics.check();
+  if (call_graph_file != NULL && !call_graph.write(call_graph_file))
+    cerr << "Could not write call graph " << call_graph_file << endl;
+}
+
+void dump_phase(Program program)
+{
+  cout.flush();
+  DumpWriter out(1);
+  dump_tree(out, program, dump_format);
+  out.flush();
+}
+
+void reset_unit()
+{
+  yylex_destroy();
+  curr_lineno = 1;
+  reset_semant();
+  diagnostics.reset();
+}
+
+static void close_input(const char *file)
+{
+  if (strcmp(file, "-") != 0)
+    fclose(fin);
+}
+
+// the phases on fin, after forgetting the file before
+static int compile_input(Phase stop_after)
+{
+  reset_unit();
+  Program program = parse_phase();
+  if (program == NULL)
+    return -1;
+  if (stop_after != PhaseParse)
+    semant_phase(program);
+  if (stop_after != PhaseSemant)
+    dump_phase(program);
+  return 0;
+}
+
+static void write_all(int fd, const std::string &s)
+{
+  for (size_t done = 0; done < s.size(); ) {
+    ssize_t w = write(fd, s.data() + done, s.size() - done);
+    if (w <= 0)
+      return;
+    done += w;
+  }
+}
+
+static void read_all(FILE *f, std::string &s)
+{
+  char buf[1 << 16];
+  ssize_t n;
+  lseek(fileno(f), 0, SEEK_SET);
+  while ((n = read(fileno(f), buf, sizeof buf)) > 0)
+    s.append(buf, n);
+}
+
+//
+// compile_input() with the result taken from the output cache if it is
+// there, and stored in it if not (outcache.h).  fin is read once for the
+// key, and again from the start, or from a copy if it cannot seek, when
+// the file has to be compiled.
+//
+static int compile_cached(Phase stop_after)
+{
+  std::string source;
+  read_all(fin, source);
+  CacheKey key = output_key(source, stop_after);
+  CachedOutput result;
+  if (!output_load(cache_dir, key, result)) {
+    FILE *input = fin, *copy = NULL;
+    bool seekable = lseek(fileno(fin), 0, SEEK_SET) == 0;
+    if (!seekable)
+      copy = tmpfile();
+    FILE *out = tmpfile(), *err = tmpfile();
+    if ((!seekable && copy == NULL) || out == NULL || err == NULL) {
+      cerr << "Could not make temporary files for the output cache" << endl;
+      return 1;
+    }
+    if (copy != NULL) {
+      write_all(fileno(copy), source);
+      lseek(fileno(copy), 0, SEEK_SET);
+      fin = copy;
+    }
+
+    // errors must come back here rather than end the process
+    bool recover = diagnostics.recover;
+    diagnostics.recover = true;
+    cout.flush();
+    fflush(stdout);
+    fflush(stderr);
+    int saved_out = dup(1), saved_err = dup(2);
+    dup2(fileno(out), 1);
+    dup2(fileno(err), 2);
+    try {
+      result.status = compile_input(stop_after);
+    } catch (CompileHalted &h) {
+      result.status = h.status;
+    }
+    cout.flush();
+    fflush(stdout);
+    fflush(stderr);
+    dup2(saved_out, 1);
+    dup2(saved_err, 2);
+    close(saved_out);
+    close(saved_err);
+    diagnostics.recover = recover;
+    if (copy != NULL)
+      fclose(copy);
+    fin = input;
+
+    read_all(out, result.out);
+    read_all(err, result.err);
+    fclose(out);
+    fclose(err);
+    output_store(cache_dir, key, result);
+  }
+  cout.flush();
+  write_all(2, result.err);
+  write_all(1, result.out);
+  return result.status;
+}
+
+int compile_file(const char *file, Phase stop_after)
+{
+  fin = strcmp(file, "-") == 0 ? stdin : fopen(file, "r");
+  if (fin == NULL) {
+    cerr << "Could not open input file " << file << endl;
+    return 1;
+  }
+  int status;
+  try {
+    if (cache_dir != NULL && call_graph_file == NULL)
+      status = compile_cached(stop_after);
+    else
+      status = compile_input(stop_after);
+  } catch (...) {
+    close_input(file);
+    throw;
+  }
+  close_input(file);
+  return status;
+}
@@ -0,0 +1,52 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _FRONTEND_H_
+#define _FRONTEND_H_
+
+#include "seal-stmt.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Front end
+//
+//  The phases here and everything they use are linked with the library
+//  ../frontend builds, libsealfe.a, into semant, sealc, semant-bench and
+//  semant-judge; parser uses the same library.  A driver defines fin
+//  and curr_filename, calls handle_flags() and then the phases, each of
+//  which takes the tree the one before it returned:
+//
+//      Program p = parse_phase();      // reads fin; NULL on syntax errors
+//      semant_phase(p);                // exits on semantic errors
+//      dump_phase(p);                  // to standard output, as -f says
+//
+//  A phase reports its errors as semant always has; parse_phase() leaves
+//  the exit to the driver.
+//
+//  compile_file() does all of this for one file, after reset_unit() has
+//  forgotten the file before: the scanner, the parser's result and error
+//  count, the tables of semantic analysis and the diagnostics seen.  The
+//  string tables, and so the builtin symbols, are kept.  It returns the
+//  status semant would exit with; see batch.h for many files.  The file
+//  "-" is standard input.  With -C the result may come from the output
+//  cache (outcache.h) instead.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// the phases sealc can stop after (--stop-after=)
+enum Phase { PhaseParse, PhaseSemant, PhaseAll };
+
+Program parse_phase();
+void semant_phase(Program program);
+void dump_phase(Program program);
+
+void initialize_constants();    // semant.cc: the builtin symbols
+void reset_semant();            // semant.cc
+void reset_unit();
+int compile_file(const char *file, Phase stop_after);
+
+#endif
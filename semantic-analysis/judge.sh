@@ -1,9 +1,16 @@
 #!/bin/bash
 
+# A test with a <name>.flags file is run with those flags, and its answer
+# holds standard error too and then the exit status.
 cd test
 for filename in *.seal; do
     echo "--------Test using" $filename "--------"
-    ../semant $filename > tempfile
+    if [ -f $filename.flags ]; then
+        ../semant $(cat $filename.flags) $filename > tempfile 2>&1
+        echo "exit $?" >> tempfile
+    else
+        ../semant $filename > tempfile
+    fi
     diff tempfile ../test-answer/$filename.out > /dev/null
     if [ $? -eq 0 ]; then
         echo "Passed"
@@ -0,0 +1,60 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include "diagnostics.h"
+#include "outcache.h"
+
+extern int yy_flex_debug;
+extern int seal_yydebug;
+extern int lex_verbose;
+extern int semant_debug;
+extern int remove_dead_decls;
+extern int check_dead_decls;
+extern int dump_format;
+extern int cgen_optimize;
+extern long long cache_limit;
+
+CacheKey output_key(const std::string &source, int phase)
+{
+    CacheHasher h;
+    CacheKey build = build_id();
+    h.add("output", 6);
+    h.add(build.key);
+    h.add(build.check);
+    int flags[] = { phase, dump_format, remove_dead_decls, check_dead_decls,
+                    cgen_optimize, diagnostics.dedupe, diagnostics.format,
+                    diagnostics.max_errors, semant_debug, yy_flex_debug,
+                    seal_yydebug, lex_verbose };
+    for (size_t i = 0; i < sizeof flags / sizeof flags[0]; i++)
+        h.add((unsigned long long) flags[i]);
+    h.add(source.data(), source.size());
+    return h.key();
+}
+
+// payload: "<status> <length of out>\n", then out and err
+bool output_load(const char *dir, const CacheKey &k, CachedOutput &result)
+{
+    std::string payload;
+    int status, header;
+    size_t out_length;
+    if (!cache_load(dir, k, payload) ||
+        sscanf(payload.c_str(), "%d %zu%n", &status, &out_length, &header) != 2 ||
+        payload[header] != '\n' || header + 1 + out_length > payload.size())
+        return false;
+    result.status = status;
+    result.out.assign(payload, header + 1, out_length);
+    result.err.assign(payload, header + 1 + out_length, std::string::npos);
+    return true;
+}
+
+void output_store(const char *dir, const CacheKey &k, const CachedOutput &result)
+{
+    char header[64];
+    snprintf(header, sizeof header, "%d %zu\n", result.status, result.out.size());
+    cache_store(dir, k, header + result.out + result.err);
+    cache_trim(dir, cache_limit);
+}
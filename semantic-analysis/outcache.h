@@ -0,0 +1,44 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _OUTCACHE_H_
+#define _OUTCACHE_H_
+
+#include <string>
+#include "semcache.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Output cache
+//
+//  With -C, compile_file() keeps the whole result of compiling a file in
+//  the cache directory next to the checked functions (semcache.h): what
+//  went to standard output and standard error, and the exit status.  The
+//  key is a hash of
+//
+//      the source, byte for byte
+//      the build of the compiler: a hash of its own executable
+//      the phase it stops after and every flag that can change what is
+//      written: -f, -D, -K, -O, -u, -J, -e and the debugging flags
+//
+//  so a file compiled again, by this or another process sharing the
+//  directory, is answered from the cache before it is lexed.  -G writes
+//  a file of its own and so is not cached.  After a store the directory
+//  is trimmed to -M bytes, least recently used first.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+struct CachedOutput {
+    int status;
+    std::string out, err;
+};
+
+CacheKey output_key(const std::string &source, int phase);
+bool output_load(const char *dir, const CacheKey &k, CachedOutput &result);
+void output_store(const char *dir, const CacheKey &k, const CachedOutput &result);
+
+#endif
@@ -0,0 +1,44 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  sealc-client.cc
+//
+//  Compiles with a running sealc --server instead of in this process.
+//
+//      ./sealc-client [--socket=path] [sealc arguments]
+//
+//  The arguments, output and exit status are those of sealc; file names
+//  are taken relative to this directory, and "-" sends standard input.
+//  The socket is the server's default (compileserver.h) without --socket.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include "seal-io.h"
+#include "compileserver.h"
+
+int main(int argc, char *argv[]) {
+    const char *socket_path = NULL;
+    int kept = 1;
+    for (int i = 1; i < argc; i++)
+        if (strncmp(argv[i], "--socket=", 9) == 0)
+            socket_path = argv[i] + 9;
+        else
+            argv[kept++] = argv[i];
+    argv[kept] = NULL;
+    if (socket_path == NULL && (socket_path = default_socket()) == NULL)
+        return 1;
+
+    int status = request_compile(socket_path, kept, argv);
+    if (status < 0) {
+        cerr << argv[0] << ": no compile server at " << socket_path
+             << " (start one with sealc --server)" << endl;
+        return 1;
+    }
+    return status;
+}
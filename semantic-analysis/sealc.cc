@@ -0,0 +1,150 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  sealc.cc
+//
+//  The compiler driver: lexes, parses, checks and dumps a program in one
+//  process, handing the tree from each phase to the next.
+//
+//      ./sealc [--stop-after=parse|semant] [semant flags] file...
+//
+//  --stop-after=parse    dump the tree as parsed, without types
+//  --stop-after=semant   check only: errors and exit status, no dump
+//
+//  Without it the program is checked and the typed tree dumped, as by
+//  semant; the other flags are those of semant, and so is the handling
+//  of several files (batch.h).
+//
+//      ./sealc --server [--socket=path] [-j jobs]
+//
+//  compiles for sealc-client instead, until killed (compileserver.h).
+//  Each request is compiled with its own flags alone: the server takes
+//  no flag but -j.
+//
+//      ./sealc --watch [--debounce=ms] [flags] file-or-directory...
+//
+//  compiles the files, then again each time one changes (watch.h).
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>    // for getopt
+#include "frontend.h"
+#include "batch.h"
+#include "compileserver.h"
+#include "watch.h"
+
+thread_local FILE *fin;       // input file
+extern int optind;  // used for option processing (man 3 getopt for more info)
+thread_local char *curr_filename = "<stdin>";
+
+void handle_flags(int argc, char *argv[]);
+extern int jobs;
+
+static Phase stop_after = PhaseAll;
+static bool server = false;     // --server
+static bool serving = false;    // running a request of the server
+static const char *socket_path = NULL;
+static bool watch = false;      // --watch
+static int debounce_ms = 10;
+
+static void usage(const char *name)
+{
+    cerr << "usage: " << name
+         << " [--stop-after=parse|semant] [semant flags] file...\n"
+         << "       " << name << " --server [--socket=path] [-j jobs]\n"
+         << "       " << name << " --watch [--debounce=ms] [semant flags] file-or-directory...\n";
+    exit(1);
+}
+
+//
+// Takes the long options out of argv, leaving the rest for handle_flags().
+// Returns the new argc.
+//
+static int driver_flags(int argc, char *argv[])
+{
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strcmp(arg, "--") == 0) {
+            while (i < argc)
+                argv[kept++] = argv[i++];
+            break;
+        }
+        if (strncmp(arg, "--", 2) != 0) {
+            argv[kept++] = argv[i];
+            continue;
+        }
+        if (strcmp(arg, "--stop-after=parse") == 0)
+            stop_after = PhaseParse;
+        else if (strcmp(arg, "--stop-after=semant") == 0)
+            stop_after = PhaseSemant;
+        else if (strcmp(arg, "--server") == 0 && !serving)
+            server = true;
+        else if (strncmp(arg, "--socket=", 9) == 0 && !serving)
+            socket_path = arg + 9;
+        else if (strcmp(arg, "--watch") == 0 && !serving)
+            watch = true;
+        else if (strncmp(arg, "--debounce=", 11) == 0)
+            debounce_ms = atoi(arg + 11);
+        else {
+            cerr << argv[0] << ": unknown option " << arg << "\n";
+            usage(argv[0]);
+        }
+    }
+    argv[kept] = NULL;
+    return kept;
+}
+
+static int compile(const char *file) {
+    return compile_file(file, stop_after);
+}
+
+static int serve_request(int argc, char *argv[]);
+
+static int sealc_main(int argc, char *argv[]) {
+    argc = driver_flags(argc, argv);
+    if (server) {
+        // the flags of a compile are those of its request; only -j is the server's
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+                i++;
+            else if (strncmp(argv[i], "-j", 2) != 0)
+                usage(argv[0]);
+        }
+    }
+    handle_flags(argc, argv);
+    if (server) {
+        if (optind < argc)
+            usage(argv[0]);
+        initialize_constants();
+        if (socket_path == NULL && (socket_path = default_socket()) == NULL)
+            return 1;
+        return serve(socket_path, jobs, serve_request);
+    }
+    if (optind >= argc)
+        usage(argv[0]);
+    if (watch)
+        return watch_files(argc - optind, argv + optind, compile, debounce_ms);
+    return compile_batch(argc - optind, argv + optind, compile);
+}
+
+// a request to the server, in a process of its own
+static int serve_request(int argc, char *argv[]) {
+    serving = true;
+    server = false;
+    stop_after = PhaseAll;
+    optind = 0;         // getopt starts over
+    return sealc_main(argc, argv);
+}
+
+int main(int argc, char *argv[]) {
+    return sealc_main(argc, argv);
+}
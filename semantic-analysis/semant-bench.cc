@@ -0,0 +1,144 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  semant-bench.cc
+//
+//  Times semantic analysis of an expression-heavy program, made up on the
+//  fly: functions full of assignments whose right sides are random, well
+//  typed trees of every arithmetic, comparison, logical and bit operator
+//  over Int, Float and Bool variables and constants.  Only semant() is
+//  timed, not the parse.
+//
+//      ./semant-bench [-j jobs] [functions]
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "seal-decl.h"
+#include "seal-expr.h"
+#include "seal-stmt.h"
+#include "parse_context.h"
+
+extern int optind;
+thread_local FILE *fin;
+thread_local char *curr_filename = "<bench>";
+
+void handle_flags(int argc, char *argv[]);
+
+static unsigned long long seed = 12345;
+
+static int rnd(int n)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (seed >> 33) % n;
+}
+
+static int nodes;
+
+//
+// Write a random expression of type t ('i', 'f' or 'b') and depth d.
+//
+static void expr(FILE *f, char t, int d)
+{
+    static const char *int_ops[] = { "+", "-", "*", "/", "%", "&", "|", "^" };
+    static const char *float_ops[] = { "+", "-", "*", "/" };
+    static const char *cmp_ops[] = { "<", "<=", ">", ">=", "==", "!=" };
+    static const char *bool_ops[] = { "&&", "||", "^" };
+
+    nodes++;
+    if (d == 0) {
+        if (t == 'i' && rnd(2))
+            fprintf(f, "%c", 'a' + rnd(2));
+        else if (t == 'i')
+            fprintf(f, "%d", rnd(100));
+        else if (t == 'f' && rnd(2))
+            fprintf(f, "%c", 'x' + rnd(2));
+        else if (t == 'f')
+            fprintf(f, "%d.5", rnd(10));
+        else
+            fprintf(f, "%s", rnd(2) ? (rnd(2) ? "p" : "q") : (rnd(2) ? "true" : "false"));
+        return;
+    }
+    int k = rnd(8);
+    fprintf(f, "(");
+    if (t == 'i' && k == 0) {
+        fprintf(f, rnd(2) ? "-" : "~");
+        expr(f, 'i', d - 1);
+    } else if (t == 'i') {
+        expr(f, 'i', d - 1);
+        fprintf(f, " %s ", int_ops[rnd(8)]);
+        expr(f, 'i', d - 1);
+    } else if (t == 'f' && k == 0) {
+        fprintf(f, "-");
+        expr(f, 'f', d - 1);
+    } else if (t == 'f') {
+        char l = rnd(2) ? 'i' : 'f';
+        expr(f, l, d - 1);
+        fprintf(f, " %s ", float_ops[rnd(4)]);
+        expr(f, l == 'i' ? 'f' : (rnd(2) ? 'i' : 'f'), d - 1);
+    } else if (k == 0) {
+        fprintf(f, "!");
+        expr(f, 'b', d - 1);
+    } else if (k < 4) {
+        expr(f, 'b', d - 1);
+        fprintf(f, " %s ", bool_ops[rnd(3)]);
+        expr(f, 'b', d - 1);
+    } else {
+        expr(f, rnd(2) ? 'i' : 'f', d - 1);
+        fprintf(f, " %s ", cmp_ops[rnd(6)]);
+        expr(f, rnd(2) ? 'i' : 'f', d - 1);
+    }
+    fprintf(f, ")");
+}
+
+static double now()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    handle_flags(argc, argv);
+    int functions = optind < argc ? atoi(argv[optind]) : 200;
+
+    fin = tmpfile();
+    for (int i = 0; i < functions; i++) {
+        fprintf(fin, "Int func f%d(Int a, Float x, Bool p) {\n"
+                     "    Int b;\n    Float y;\n    Bool q;\n", i);
+        for (int s = 0; s < 50; s++) {
+            static const char types[] = "ifb", vars[] = "bypq";
+            int t = rnd(3);
+            fprintf(fin, "    %c = ", t == 2 ? vars[2 + rnd(2)] : vars[t]);
+            expr(fin, types[t], 5);
+            fprintf(fin, ";\n");
+        }
+        fprintf(fin, "    return b;\n}\n");
+    }
+    fprintf(fin, "Void func main() {\n    return;\n}\n");
+    rewind(fin);
+
+    ParseContext ctx(curr_filename);
+    curr_lineno = 1;
+    semant_yyparse(&ctx);
+    if (ctx.omerrs != 0 || ctx.ast_root == NULL) {
+        cerr << "semant-bench: generated program does not parse" << endl;
+        exit(1);
+    }
+
+    double t0 = now();
+    ctx.ast_root->semant();
+    double t1 = now();
+    printf("%d functions, %d expression nodes: semant %.3f s, %.1f ns per node\n",
+           functions, nodes, t1 - t0, (t1 - t0) * 1e9 / nodes);
+    return 0;
+}
@@ -0,0 +1,526 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  semant-judge.cc
+//
+//  The golden tests of judge.sh without a process per test: every
+//  <tests>/*.seal is checked and dumped by the front end linked in, and
+//  what it writes to standard output is compared in memory with
+//  <answers>/<name>.seal.out.
+//
+//      ./semant-judge [-j jobs] [--junit=file] [--json=file] [tests [answers]]
+//
+//  tests and answers are test and test-answer by default.  With -j 1 the
+//  tests run one after another in this process.  Otherwise they run -j
+//  at a time (0: one per CPU), each in a process forked for it, as the
+//  front end keeps the state of semantic analysis in globals; only the
+//  main thread forks, and the next test starts whenever one finishes.
+//  A test with a <name>.seal.flags file is run with those flags, in a
+//  process of its own, and compared as judge.sh does: standard output
+//  and error together, then "exit N".  Each test is reported with its
+//  time, and a unified diff when it fails; --junit and --json write
+//  reports for CI.  The exit status is 0 if every test passed.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "diagnostics.h"
+#include "workpool.h"
+#include "frontend.h"
+
+thread_local FILE *fin;
+extern int optind;
+thread_local char *curr_filename = "<stdin>";
+
+void handle_flags(int argc, char *argv[]);
+extern int jobs;
+
+struct TestCase {
+    std::string name;           // test1.seal
+    std::string source;         // tests/test1.seal
+    std::string answer;         // answers/test1.seal.out
+    bool has_answer;
+    bool has_flags;
+    std::vector<std::string> flags;     // from tests/test1.seal.flags
+    FILE *out_file, *err_file;  // where it writes while it runs
+    std::chrono::steady_clock::time_point start;
+    std::string out, err;       // what the front end wrote
+    int status;
+    double ms;
+    bool passed;
+    std::string diff;
+};
+
+static bool read_file(const std::string &path, std::string &s)
+{
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in)
+        return false;
+    std::ostringstream buf;
+    buf << in.rdbuf();
+    s = buf.str();
+    return true;
+}
+
+static void read_all(FILE *f, std::string &s)
+{
+    char buf[1 << 16];
+    ssize_t n;
+    lseek(fileno(f), 0, SEEK_SET);
+    while ((n = read(fileno(f), buf, sizeof buf)) > 0)
+        s.append(buf, n);
+}
+
+//
+// Unified diff
+//
+
+static void split_lines(const std::string &s, std::vector<std::string> &lines)
+{
+    size_t start = 0;
+    while (start < s.size()) {
+        size_t nl = s.find('\n', start);
+        if (nl == std::string::npos) {
+            lines.push_back(s.substr(start) + "\n\\ No newline at end of file");
+            break;
+        }
+        lines.push_back(s.substr(start, nl - start));
+        start = nl + 1;
+    }
+}
+
+struct Edit {
+    char op;                    // ' ', '-' or '+'
+    int a, b;                   // lines of a and b before it
+};
+
+//
+// The edits from a to b: a longest common subsequence of the lines
+// between the common prefix and suffix.  Should that be too large to
+// find, all of it is taken as changed.
+//
+static std::vector<Edit> edits(const std::vector<std::string> &a,
+                               const std::vector<std::string> &b)
+{
+    int n = a.size(), m = b.size(), pre = 0, suf = 0;
+    while (pre < n && pre < m && a[pre] == b[pre])
+        pre++;
+    while (suf < n - pre && suf < m - pre && a[n - 1 - suf] == b[m - 1 - suf])
+        suf++;
+    int rn = n - pre - suf, rm = m - pre - suf;
+
+    // lcs[i][j]: of a[pre + i ..] and b[pre + j ..] in the middle
+    std::vector<std::vector<int> > lcs;
+    bool small = (long long) rn * rm <= 25000000LL;
+    if (small) {
+        lcs.assign(rn + 1, std::vector<int>(rm + 1, 0));
+        for (int i = rn - 1; i >= 0; i--)
+            for (int j = rm - 1; j >= 0; j--)
+                lcs[i][j] = a[pre + i] == b[pre + j]
+                    ? lcs[i + 1][j + 1] + 1 : std::max(lcs[i + 1][j], lcs[i][j + 1]);
+    }
+
+    std::vector<Edit> e;
+    int i = 0, j = 0;
+    for (; i < pre; i++, j++)
+        e.push_back(Edit { ' ', i, j });
+    int ei = pre + rn, ej = pre + rm;
+    while (i < ei || j < ej) {
+        if (small && i < ei && j < ej && a[i] == b[j]) {
+            e.push_back(Edit { ' ', i++, j++ });
+        } else if (i < ei && (j == ej || !small ||
+                              lcs[i - pre + 1][j - pre] >= lcs[i - pre][j - pre + 1])) {
+            e.push_back(Edit { '-', i++, j });
+        } else {
+            e.push_back(Edit { '+', i, j++ });
+        }
+    }
+    for (; i < n; i++, j++)
+        e.push_back(Edit { ' ', i, j });
+    return e;
+}
+
+static std::string hunk_range(int start, int count)
+{
+    std::ostringstream s;
+    s << (count == 0 ? start : start + 1);
+    if (count != 1)
+        s << "," << count;
+    return s.str();
+}
+
+static std::string unified_diff(const std::string &expected, const std::string &actual,
+                                const std::string &from, const std::string &to)
+{
+    const int context = 3;
+    std::vector<std::string> a, b;
+    split_lines(expected, a);
+    split_lines(actual, b);
+    std::vector<Edit> e = edits(a, b);
+
+    std::ostringstream out;
+    out << "--- " << from << "\n+++ " << to << "\n";
+    int k = 0, size = e.size();
+    while (k < size) {
+        while (k < size && e[k].op == ' ')
+            k++;
+        if (k == size)
+            break;
+        // a hunk: changes no more than 2 * context lines apart
+        int first = std::max(0, k - context), last = k;
+        for (int gap = 0; k < size && gap <= 2 * context; k++) {
+            if (e[k].op == ' ')
+                gap++;
+            else {
+                gap = 0;
+                last = k;
+            }
+        }
+        int end = std::min(size, last + context + 1);
+        int a_count = 0, b_count = 0;
+        for (int x = first; x < end; x++) {
+            a_count += e[x].op != '+';
+            b_count += e[x].op != '-';
+        }
+        out << "@@ -" << hunk_range(e[first].a, a_count)
+            << " +" << hunk_range(e[first].b, b_count) << " @@\n";
+        for (int x = first; x < end; x++)
+            out << e[x].op << (e[x].op == '+' ? b[e[x].b] : a[e[x].a]) << "\n";
+        k = end;
+    }
+    return out.str();
+}
+
+//
+// Running a test
+//
+
+// compiles t.source with standard output and error already redirected
+static int compile_test(const TestCase &t)
+{
+    int status;
+    try {
+        status = compile_file(t.source.c_str(), PhaseAll);
+    } catch (CompileHalted &h) {
+        status = h.status;
+    }
+    cout.flush();
+    fflush(stdout);
+    fflush(stderr);
+    return status;
+}
+
+//
+// Starts t with its standard output and error going to temporary files:
+// in a forked process if fork_it or t has flags of its own, returning
+// its pid, else in this process, returning 0 once it is done.  Returns
+// -1, with t.status set, if it could not be started.
+//
+static pid_t start_test(TestCase &t, bool fork_it)
+{
+    t.start = std::chrono::steady_clock::now();
+    t.out_file = tmpfile();
+    t.err_file = tmpfile();
+    if (t.out_file == NULL || t.err_file == NULL) {
+        t.status = 1;
+        t.err = "Could not make temporary files\n";
+        return -1;
+    }
+    if (fork_it || t.has_flags) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            dup2(fileno(t.out_file), 1);
+            dup2(fileno(t.has_flags ? t.out_file : t.err_file), 2);
+            if (t.has_flags) {
+                std::vector<char *> argv(1, (char *) "semant");
+                for (size_t i = 0; i < t.flags.size(); i++)
+                    argv.push_back((char *) t.flags[i].c_str());
+                argv.push_back(NULL);
+                optind = 0;
+                handle_flags(argv.size() - 1, &argv[0]);
+                jobs = 1;
+            }
+            exit(compile_test(t) & 0xff);
+        }
+        if (pid < 0) {
+            t.status = 1;
+            t.err = "Could not start a process for " + t.source + "\n";
+        }
+        return pid;
+    }
+    int saved_out = dup(1), saved_err = dup(2);
+    dup2(fileno(t.out_file), 1);
+    dup2(fileno(t.err_file), 2);
+    t.status = compile_test(t);
+    dup2(saved_out, 1);
+    dup2(saved_err, 2);
+    close(saved_out);
+    close(saved_err);
+    return 0;
+}
+
+// collects what t wrote and compares it with the answer
+static void finish_test(TestCase &t)
+{
+    if (t.out_file != NULL) {
+        read_all(t.out_file, t.out);
+        fclose(t.out_file);
+    }
+    if (t.err_file != NULL) {
+        read_all(t.err_file, t.err);
+        fclose(t.err_file);
+    }
+
+    std::string expected;
+    t.has_answer = read_file(t.answer, expected);
+    if (t.has_flags)
+        t.out += "exit " + std::to_string(t.status) + "\n";
+    t.passed = t.has_answer && t.out == expected;
+    if (t.has_answer && !t.passed)
+        t.diff = unified_diff(expected, t.out, t.answer, t.name + " (semant)");
+    t.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t.start).count();
+}
+
+//
+// Reports
+//
+
+static std::string json_string(const std::string &s)
+{
+    std::string r = "\"";
+    for (size_t i = 0; i < s.size(); i++) {
+        unsigned char c = s[i];
+        if (c == '"' || c == '\\')
+            r += '\\', r += c;
+        else if (c == '\n')
+            r += "\\n";
+        else if (c == '\t')
+            r += "\\t";
+        else if (c < 0x20) {
+            char hex[8];
+            snprintf(hex, sizeof hex, "\\u%04x", c);
+            r += hex;
+        } else
+            r += c;
+    }
+    return r + "\"";
+}
+
+static std::string xml_text(const std::string &s)
+{
+    std::string r;
+    for (size_t i = 0; i < s.size(); i++)
+        switch (s[i]) {
+        case '<': r += "&lt;"; break;
+        case '>': r += "&gt;"; break;
+        case '&': r += "&amp;"; break;
+        case '"': r += "&quot;"; break;
+        default:
+            if ((unsigned char) s[i] >= 0x20 || s[i] == '\n' || s[i] == '\t')
+                r += s[i];
+        }
+    return r;
+}
+
+static void write_json(const char *file, const std::vector<TestCase> &tests,
+                       int failed, double seconds)
+{
+    std::ofstream out(file);
+    out << "{\"tests\": " << tests.size() << ", \"passed\": " << tests.size() - failed
+        << ", \"failed\": " << failed << ", \"seconds\": " << seconds << ", \"cases\": [";
+    for (size_t i = 0; i < tests.size(); i++) {
+        const TestCase &t = tests[i];
+        out << (i ? ",\n  " : "\n  ") << "{\"name\": " << json_string(t.name)
+            << ", \"passed\": " << (t.passed ? "true" : "false")
+            << ", \"status\": " << t.status << ", \"ms\": " << t.ms;
+        if (!t.has_answer)
+            out << ", \"error\": " << json_string("no answer " + t.answer);
+        if (!t.diff.empty())
+            out << ", \"diff\": " << json_string(t.diff);
+        if (!t.err.empty())
+            out << ", \"stderr\": " << json_string(t.err);
+        out << "}";
+    }
+    out << "\n]}\n";
+}
+
+static void write_junit(const char *file, const std::vector<TestCase> &tests,
+                        int failed, double seconds)
+{
+    std::ofstream out(file);
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<testsuite name=\"semant\" tests=\"" << tests.size() << "\" failures=\""
+        << failed << "\" errors=\"0\" time=\"" << seconds << "\">\n";
+    for (size_t i = 0; i < tests.size(); i++) {
+        const TestCase &t = tests[i];
+        out << "  <testcase classname=\"semant\" name=\"" << xml_text(t.name)
+            << "\" time=\"" << t.ms / 1000 << "\">\n";
+        if (!t.has_answer)
+            out << "    <failure message=\"no answer " << xml_text(t.answer) << "\"/>\n";
+        else if (!t.passed)
+            out << "    <failure message=\"output differs\">" << xml_text(t.diff)
+                << "</failure>\n";
+        if (!t.err.empty())
+            out << "    <system-err>" << xml_text(t.err) << "</system-err>\n";
+        out << "  </testcase>\n";
+    }
+    out << "</testsuite>\n";
+}
+
+static double cpu_seconds()
+{
+    struct rusage self, children;
+    getrusage(RUSAGE_SELF, &self);
+    getrusage(RUSAGE_CHILDREN, &children);
+    return self.ru_utime.tv_sec + self.ru_utime.tv_usec / 1e6 +
+        self.ru_stime.tv_sec + self.ru_stime.tv_usec / 1e6 +
+        children.ru_utime.tv_sec + children.ru_utime.tv_usec / 1e6 +
+        children.ru_stime.tv_sec + children.ru_stime.tv_usec / 1e6;
+}
+
+static void usage(const char *name)
+{
+    cerr << "usage: " << name
+         << " [-j jobs] [--junit=file] [--json=file] [tests [answers]]\n";
+    exit(1);
+}
+
+int main(int argc, char *argv[]) {
+    const char *junit = NULL, *json = NULL;
+    int kept = 1;
+    for (int i = 1; i < argc; i++)
+        if (strncmp(argv[i], "--junit=", 8) == 0)
+            junit = argv[i] + 8;
+        else if (strncmp(argv[i], "--json=", 7) == 0)
+            json = argv[i] + 7;
+        else if (strncmp(argv[i], "--", 2) == 0 && argv[i][2] != '\0')
+            usage(argv[0]);
+        else
+            argv[kept++] = argv[i];
+    argv[kept] = NULL;
+    argc = kept;
+    handle_flags(argc, argv);
+    if (argc - optind > 2)
+        usage(argv[0]);
+    std::string test_dir = optind < argc ? argv[optind] : "test";
+    std::string answer_dir = optind + 1 < argc ? argv[optind + 1] : "test-answer";
+
+    std::vector<std::string> names;
+    DIR *d = opendir(test_dir.c_str());
+    if (d == NULL) {
+        cerr << "Could not open test directory " << test_dir << endl;
+        return 1;
+    }
+    for (struct dirent *e; (e = readdir(d)) != NULL; ) {
+        std::string name = e->d_name;
+        if (name.size() > 5 && name.compare(name.size() - 5, 5, ".seal") == 0)
+            names.push_back(name);
+    }
+    closedir(d);
+    std::sort(names.begin(), names.end());
+
+    std::vector<TestCase> tests(names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        tests[i].name = names[i];
+        tests[i].source = test_dir + "/" + names[i];
+        tests[i].answer = answer_dir + "/" + names[i] + ".out";
+        std::string flags;
+        tests[i].has_flags = read_file(tests[i].source + ".flags", flags);
+        std::istringstream words(flags);
+        for (std::string w; words >> w; )
+            tests[i].flags.push_back(w);
+    }
+
+    int n = tests.size();
+    int workers = parallel_threads(n, jobs);
+    jobs = 1;                   // each test on one thread
+    diagnostics.recover = true;
+    cout.flush();
+    fflush(stdout);
+    fflush(stderr);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    double cpu_start = cpu_seconds();
+    std::vector<bool> done(n, false);
+    std::map<pid_t, int> running;
+    int started = 0, next = 0, failed = 0;
+    while (next < n) {
+        // only this thread forks: up to workers tests at a time
+        for (; started < n && (int) running.size() < workers; started++) {
+            pid_t pid = start_test(tests[started], workers > 1);
+            if (pid > 0)
+                running[pid] = started;
+            else {
+                finish_test(tests[started]);
+                done[started] = true;
+            }
+        }
+        if (!running.empty()) {
+            int st;
+            pid_t pid = waitpid(-1, &st, 0);
+            if (pid < 0 && errno == EINTR)
+                continue;
+            if (pid < 0) {
+                for (std::map<pid_t, int>::iterator r = running.begin();
+                     r != running.end(); ++r) {
+                    tests[r->second].status = 1;
+                    finish_test(tests[r->second]);
+                    done[r->second] = true;
+                }
+                running.clear();
+            } else if (running.count(pid)) {
+                int i = running[pid];
+                running.erase(pid);
+                tests[i].status = WIFEXITED(st) ? WEXITSTATUS(st) : 128 + WTERMSIG(st);
+                finish_test(tests[i]);
+                done[i] = true;
+            }
+        }
+
+        // report in the order of the names, as soon as each is known
+        for (; next < n && done[next]; next++) {
+            const TestCase &t = tests[next];
+            char ms[32];
+            snprintf(ms, sizeof ms, "%.2f ms", t.ms);
+            cout << t.name << ": " << (t.passed ? "Passed" : "NOT passed")
+                 << " (" << ms << ")\n";
+            if (!t.has_answer)
+                cout << "  no answer " << t.answer << "\n";
+            cout << t.diff;
+            failed += !t.passed;
+        }
+        cout.flush();
+    }
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    char times[128];
+    snprintf(times, sizeof times, "%.2fs wall, %.2fs cpu, %d worker%s", wall,
+             cpu_seconds() - cpu_start, workers, workers == 1 ? "" : "s");
+    cout << n << " tests, " << n - failed << " passed, " << failed << " failed; "
+         << times << endl;
+    if (json != NULL)
+        write_json(json, tests, failed, wall);
+    if (junit != NULL)
+        write_junit(junit, tests, failed, wall);
+    return failed > 0 ? 1 : 0;
+}
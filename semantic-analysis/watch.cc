@@ -0,0 +1,184 @@
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "seal-io.h"
+#include "batch.h"
+#include "watch.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static bool is_seal(const std::string &name)
+{
+    return name.size() > 5 && name.compare(name.size() - 5, 5, ".seal") == 0;
+}
+
+// a directory watched, and what in it is compiled
+struct Watched {
+    std::string dir;            // as given, "" for the current one
+    bool all;                   // every .seal file
+    std::set<std::string> names;
+
+    Watched() : all(false) { }
+};
+
+static std::string join(const std::string &dir, const std::string &name)
+{
+    return dir.empty() ? name : dir + "/" + name;
+}
+
+//
+// Reads the events waiting on fd, adding the files they name to changed.
+// False if fd fails.
+//
+static bool read_events(int fd, std::map<int, Watched> &watched,
+                        std::set<std::string> &changed)
+{
+    char buf[64 * 1024] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    ssize_t len = read(fd, buf, sizeof buf);
+    if (len < 0)
+        return errno == EINTR || errno == EAGAIN;
+    for (char *p = buf; p < buf + len; ) {
+        struct inotify_event *e = (struct inotify_event *) p;
+        p += sizeof (struct inotify_event) + e->len;
+        std::map<int, Watched>::iterator w = watched.find(e->wd);
+        if (w == watched.end() || e->len == 0)
+            continue;
+        std::string name = e->name;
+        if (w->second.names.count(name) || (w->second.all && is_seal(name)))
+            changed.insert(join(w->second.dir, name));
+    }
+    return true;
+}
+
+static double ms_since(Clock::time_point t, Clock::time_point now)
+{
+    return std::chrono::duration<double, std::milli>(now - t).count();
+}
+
+int watch_files(int n, char **paths, int (*compile)(const char *file), int debounce_ms)
+{
+    int fd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+    if (fd < 0) {
+        cerr << "Could not start watching: inotify is not available" << endl;
+        return 1;
+    }
+
+    const unsigned mask = IN_CLOSE_WRITE | IN_MOVED_TO;
+    std::map<int, Watched> watched;
+    std::vector<std::string> files;     // compiled first, in this order
+    for (int i = 0; i < n; i++) {
+        std::string path = paths[i], dir, name;
+        struct stat st;
+        bool is_dir = stat(paths[i], &st) == 0 && S_ISDIR(st.st_mode);
+        if (is_dir) {
+            dir = path;
+            while (dir.size() > 1 && dir[dir.size() - 1] == '/')
+                dir.erase(dir.size() - 1);
+        } else {
+            size_t slash = path.rfind('/');
+            dir = slash == std::string::npos ? "" : path.substr(0, slash == 0 ? 1 : slash);
+            name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+        }
+        int wd = inotify_add_watch(fd, dir.empty() ? "." : dir.c_str(), mask);
+        if (wd < 0) {
+            cerr << "Could not watch " << (dir.empty() ? "." : dir) << endl;
+            continue;
+        }
+        Watched &w = watched[wd];
+        w.dir = dir;
+        if (!is_dir) {
+            w.names.insert(name);
+            files.push_back(path);
+            continue;
+        }
+        w.all = true;
+        std::vector<std::string> in_dir;
+        if (DIR *d = opendir(dir.c_str())) {
+            for (struct dirent *e; (e = readdir(d)) != NULL; )
+                if (is_seal(e->d_name))
+                    in_dir.push_back(join(dir, e->d_name));
+            closedir(d);
+        }
+        std::sort(in_dir.begin(), in_dir.end());
+        files.insert(files.end(), in_dir.begin(), in_dir.end());
+    }
+    if (watched.empty()) {
+        close(fd);
+        return 1;
+    }
+
+    std::vector<char *> argv;
+    for (size_t i = 0; i < files.size(); i++)
+        argv.push_back(&files[i][0]);
+    if (!argv.empty())
+        compile_batch(argv.size(), &argv[0], compile);
+    cout.flush();
+    cerr << "Watching " << files.size() << " file" << (files.size() == 1 ? "" : "s")
+         << "; rebuilding on change" << endl;
+
+    std::vector<double> latencies;      // from the last event of each rebuild
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    for (;;) {
+        std::set<std::string> changed;
+        if (poll(&pfd, 1, -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        Clock::time_point first = Clock::now(), last = first;
+        if (!read_events(fd, watched, changed))
+            break;
+        // the rest of the burst: until it has been quiet for debounce_ms
+        while (poll(&pfd, 1, debounce_ms) > 0) {
+            last = Clock::now();
+            if (!read_events(fd, watched, changed))
+                break;
+        }
+        if (changed.empty())
+            continue;
+
+        std::vector<std::string> names(changed.begin(), changed.end());
+        std::vector<char *> args;
+        for (size_t i = 0; i < names.size(); i++)
+            args.push_back(&names[i][0]);
+        Clock::time_point start = Clock::now();
+        int status = compile_batch(args.size(), &args[0], compile);
+        cout.flush();
+        Clock::time_point done = Clock::now();
+
+        double after_last = ms_since(last, done);
+        latencies.push_back(after_last);
+        std::vector<double> sorted(latencies);
+        std::sort(sorted.begin(), sorted.end());
+        std::string what = names.size() == 1
+            ? names[0] : std::to_string(names.size()) + " files";
+        char line[256];
+        snprintf(line, sizeof line,
+                 ": %s in %.2f ms, %.2f ms after the last change and %.2f ms "
+                 "after the first; %zu rebuild%s, median %.2f ms, max %.2f ms",
+                 status == 0 ? "ok" : "failed", ms_since(start, done), after_last,
+                 ms_since(first, done), sorted.size(), sorted.size() == 1 ? "" : "s",
+                 sorted[sorted.size() / 2], sorted.back());
+        cerr << what << line << endl;
+    }
+    cerr << "Stopped watching: " << strerror(errno) << endl;
+    close(fd);
+    return 1;
+}
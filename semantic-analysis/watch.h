@@ -0,0 +1,34 @@
+// -*-Mode: C++;-*-
+//
+// See copyright.h for copyright notice and limitation of liability
+// and disclaimer of warranty provisions.
+//
+#include "copyright.h"
+
+#ifndef _WATCH_H_
+#define _WATCH_H_
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//  Watch mode
+//
+//  watch_files(n, paths, compile, debounce_ms) compiles the files, then
+//  waits for them to change and compiles again each that did, in this
+//  process, until killed.  A path that is a directory stands for every
+//  .seal file in it, including those made later.  It watches (inotify)
+//  the directories, not the files, so that editors which save by writing
+//  a new file and renaming it over the old one are seen too.
+//
+//  A save is seldom a single event.  After the first, events are
+//  collected until none has come for debounce_ms, and then each file
+//  named by any of them is compiled once, with compile_batch().  The time
+//  it took, from the last event and from the first, goes to standard
+//  error with the median and maximum of the rebuilds so far.
+//
+//  Returns only if nothing can be watched, with status 1.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+int watch_files(int n, char **paths, int (*compile)(const char *file), int debounce_ms);
+
+#endif
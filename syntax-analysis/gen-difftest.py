@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+#
+# Writes random programs in the language of seal.y for 'make difftest'.
+# Each is built from the grammar; with -b, a share of them then have one
+# token inserted, dropped or replaced, so that the error paths of the two
+# parsers are compared too.  The same seed gives the same files.
+#
+#     python3 gen-difftest.py -n 1500 -s 1 -o difftest
+#
+
+import argparse
+import os
+import random
+
+TYPES = ["Int", "Float", "String", "Bool", "Void"]
+NAMES = ["a", "b", "c", "x", "y", "foo", "bar"]
+BINOPS = ["+", "-", "*", "/", "%", "<", "<=", "==", "!=", ">=", ">",
+          "&&", "||", "^", "&", "|"]
+UNOPS = ["-", "!", "~"]
+# what a broken program may have inserted or substituted
+NOISE = ["var", "func", "if", "else", "while", "for", "break", "continue",
+         "return", "(", ")", "{", "}", ";", ",", "=", "Int", "x", "1",
+         "+", "*", "!"]
+
+
+class Gen:
+    def __init__(self, rnd):
+        self.r = rnd
+        self.depth = 0
+
+    def chance(self, p):
+        return self.r.random() < p
+
+    def name(self):
+        return [self.r.choice(NAMES)]
+
+    def literal(self):
+        k = self.r.randrange(4)
+        if k == 0:
+            return [str(self.r.randrange(100))]
+        if k == 1:
+            return ["%d.%d" % (self.r.randrange(10), self.r.randrange(100))]
+        if k == 2:
+            return ['"%s"' % self.r.choice(["", "s", "hello", "a b"])]
+        return [self.r.choice(["true", "false"])]
+
+    def expr(self):
+        self.depth += 1
+        try:
+            if self.depth > 4:
+                return self.r.choice([self.name, self.literal])()
+            k = self.r.randrange(8)
+            if k == 0:
+                return self.name()
+            if k == 1:
+                return self.literal()
+            if k == 2:
+                return self.name() + ["="] + self.expr()
+            if k == 3:
+                return self.call()
+            if k == 4:
+                return ["("] + self.expr() + [")"]
+            if k == 5:
+                return [self.r.choice(UNOPS)] + self.expr()
+            return self.expr() + [self.r.choice(BINOPS)] + self.expr()
+        finally:
+            self.depth -= 1
+
+    def call(self):
+        out = self.name() + ["("]
+        for i in range(self.r.randrange(4)):
+            if i:
+                out.append(",")
+            out += self.expr()
+        return out + [")"]
+
+    def variable(self):
+        return self.name() + [self.r.choice(TYPES)]
+
+    def variable_decl(self):
+        return ["var"] + self.variable() + [";"]
+
+    def block(self):
+        self.depth += 1
+        try:
+            out = ["{"]
+            for _ in range(self.r.randrange(3)):
+                out += self.variable_decl()
+            for _ in range(self.r.randrange(4 if self.depth < 4 else 1)):
+                out += self.stmt()
+            return out + ["}"]
+        finally:
+            self.depth -= 1
+
+    def stmt(self):
+        k = self.r.randrange(10)
+        if k == 0:
+            return [";"]
+        if k == 1:
+            out = ["if"] + self.expr() + self.block()
+            if self.chance(0.5):
+                out += ["else"] + self.block()
+            return out
+        if k == 2:
+            return ["while"] + self.expr() + self.block()
+        if k == 3:
+            out = ["for"]
+            for part in range(3):
+                if self.chance(0.7):
+                    out += self.expr()
+                if part < 2:
+                    out.append(";")
+            return out + self.block()
+        if k == 4:
+            return ["break", ";"]
+        if k == 5:
+            return ["continue", ";"]
+        if k == 6:
+            return ["return"] + (self.expr() if self.chance(0.7) else []) + [";"]
+        if k == 7 and self.depth < 4:
+            return self.block()
+        return self.expr() + [";"]
+
+    def func(self):
+        out = ["func"] + self.name() + ["("]
+        for i in range(self.r.randrange(4)):
+            if i:
+                out.append(",")
+            out += self.variable()
+        return out + [")", self.r.choice(TYPES)] + self.block()
+
+    def program(self):
+        out = []
+        for _ in range(1 + self.r.randrange(5)):
+            out += self.variable_decl() if self.chance(0.3) else self.func()
+        return out
+
+
+def mutate(r, tokens):
+    i = r.randrange(len(tokens))
+    k = r.randrange(3)
+    if k == 0:
+        tokens.insert(i, r.choice(NOISE))
+    elif k == 1 and len(tokens) > 1:
+        del tokens[i]
+    else:
+        tokens[i] = r.choice(NOISE)
+
+
+def layout(r, tokens):
+    text = []
+    for t in tokens:
+        if text:
+            text.append(r.choice([" ", " ", " ", "\n", "\n  ", ""]
+                                 if t[0] in "(){};,\"" else [" ", "\n"]))
+        text.append(t)
+    return "".join(text) + "\n"
+
+
+def main():
+    ap = argparse.ArgumentParser(description="random programs for make difftest")
+    ap.add_argument("-n", type=int, default=1500, help="how many programs")
+    ap.add_argument("-s", type=int, default=1, help="random seed")
+    ap.add_argument("-b", type=float, default=0.5,
+                    help="share of programs with one token changed")
+    ap.add_argument("-o", default="difftest", help="output directory")
+    args = ap.parse_args()
+
+    r = random.Random(args.s)
+    os.makedirs(args.o, exist_ok=True)
+    for i in range(args.n):
+        tokens = Gen(r).program()
+        if r.random() < args.b:
+            mutate(r, tokens)
+        with open(os.path.join(args.o, "p%04d.seal" % i), "w") as f:
+            f.write(layout(r, tokens))
+
+
+if __name__ == "__main__":
+    main()
@@ -20,43 +20,187 @@
 #include "seal-expr.h"
 #include "utilities.h"  // for fatal_error
 #include "seal-parse.h"
+#include "parse_context.h"
+#include "dumpwriter.h"
+#include "dumpformat.h"
+#include "batch.h"
+#include <memory>
 
 
 //
 // These globals keep everything working.
 //
 FILE *token_file = stdin;		// we read from this file
-extern Program ast_root;	 // the AST produced by the parse
 
 extern int optind;  // used for option processing (man 3 getopt for more info)
 
-char *curr_filename = "<stdin>";
-FILE *fin;
+thread_local char *curr_filename = "<stdin>";
+thread_local FILE *fin;
 
-extern int omerrs;             // a count of lex and parse errors
+extern int parse_stream;       // -S: dump declarations as they are parsed
+extern int parse_rd;           // -R: use the hand-written parser
+extern int parse_outline;      // -L: parse function bodies only when used
+extern int parse_incremental;  // -I: reparse a new version of a file
+extern int parse_modes_accepted;
+extern int dump_format;        // -f: text, json or binary
+extern int jobs;               // -j: threads for the dump
 
-extern int seal_yyparse();
 void handle_flags(int argc, char *argv[]);
+int yylex_destroy(void);       // seal-lex.cc
+void dump_line(ostream& stream, int n, tree_node *t);
 
-int main(int argc, char *argv[]) {
-    fin = fopen(argv[optind], "r");
-	    if (fin == NULL) {
-		cerr << "Could not open input file " << argv[optind] << endl;
-		exit(1);
-	}
+//
+// In streaming mode every top-level declaration is dumped as soon as the
+// parser reduces it.  The program node carries the line of its first
+// declaration, so the output is the same as dumping the finished tree.
+//
+static int decls_dumped = 0;
+static DumpWriter *out;        // where the tree goes, standard output
+static TreeEncoder *encoder;   // for -f json and binary, else NULL
+static ParseContext *parsing;  // the file being parsed
+
+//
+// With -L a body is parsed only when first used, which would be in the
+// middle of the dump.  Each is parsed before its declaration is dumped
+// instead, so that a syntax error in it halts with nothing of that
+// declaration written, as it would have halted the parse.
+//
+static void force_body(Decl decl) {
+    decl->force_body();
+    if (parsing->omerrs != 0) {
+        parsing->diags->halt("Compilation halted due to lex and parse errors");
+    }
+}
+
+static void dump_decl(Decl decl) {
+    if (parse_outline)
+        force_body(decl);
+    if (encoder) {
+        if (decls_dumped++ == 0) {
+            encoder->begin(KProgram, decl);
+            encoder->field(FDecls, true);
+        }
+        decl->encode(*encoder);
+    } else {
+        if (decls_dumped++ == 0) {
+            dump_line(*out, 0, decl);
+            *out << "Program\n";
+        }
+        decl->dump_with_types(*out, 2);
+    }
+    out->flush();
+}
+
+//
+// parser -I old.seal new.seal ...
+// Parse each file as an edit of the one before it, keeping the trees of
+// the declarations that did not change.  Dumps the tree of the last file
+// and reports how many declarations were reused.
+//
+static int reparse(ParseContext &ctx, int argc, char *argv[]) {
+    ReparseCache cache;
+    for (int i = optind; i < argc; i++) {
+        FILE *f = i == optind ? fin : fopen(argv[i], "r");
+        if (f == NULL) {
+            cerr << "Could not open input file " << argv[i] << endl;
+            exit(1);
+        }
+        int len;
+        char *source = read_source(f, &len);
+        fclose(f);
+        seal_reparse(&ctx, &cache, source, len);
+        if (ctx.omerrs != 0) {
+            ctx.diags->halt("Compilation halted due to lex and parse errors");
+        }
+        cerr << argv[i] << ": " << cache.reused << " declarations reused, "
+             << cache.parsed << " parsed\n";
+    }
+    dump_tree(*out, ctx.ast_root, dump_format);
+    out->flush();
+    return 0;
+}
+
+//
+// Parses file and dumps its tree to standard output; returns the exit
+// status.  The scanner is reset first, so files can be parsed one after
+// another (see batch.h).
+//
+static int parse_file(const char *file) {
+    fin = fopen(file, "r");
+    if (fin == NULL) {
+        cerr << "Could not open input file " << file << endl;
+        return 1;
+    }
+    yylex_destroy();
     curr_lineno = 1;
-    handle_flags(argc, argv);
-    seal_yyparse();
-    if (omerrs != 0) {
-	    cerr << "Compilation halted due to lex and parse errors\n";
-	    exit(1);
+    ParseContext ctx(curr_filename);
+    parsing = &ctx;
+    DumpWriter writer(1);
+    out = &writer;
+    if (parse_stream) {
+        std::unique_ptr<TreeEncoder> stream_encoder(new_encoder(writer, dump_format));
+        encoder = stream_encoder.get();
+        decls_dumped = 0;
+        ctx.decl_handler = dump_decl;
+        if (parse_outline)
+            seal_outline_parse(&ctx, fin);
+        else if (parse_rd)
+            seal_rdparse(&ctx);
+        else
+            seal_yyparse_stream(&ctx);
+        if (ctx.omerrs != 0) {
+            ctx.diags->halt("Compilation halted due to lex and parse errors");
+        }
+        if (encoder)
+            encoder->finish();
+        fclose(fin);
+        return 0;
     }
-    if(ast_root == NULL) {
+    if (parse_outline)
+        seal_outline_parse(&ctx, fin);
+    else if (parse_rd)
+        seal_rdparse(&ctx);
+    else
+        seal_yyparse(&ctx);
+    if (ctx.omerrs != 0) {
+	    ctx.diags->halt("Compilation halted due to lex and parse errors");
+    }
+    if(ctx.ast_root == NULL) {
         cerr << "ast_root must be initialized.\n";
-	    exit(1);
+	    return 1;
+    }
+    if (parse_outline) {
+        std::vector<Decl> decls;
+        ctx.ast_root->getDecls()->collect(decls);
+        for (size_t i = 0; i < decls.size(); i++)
+            force_body(decls[i]);
     }
-    ast_root->dump_with_types(cout,0);
+    dump_tree(*out, ctx.ast_root, dump_format);
+    out->flush();
     fclose(fin);
     return 0;
 }
 
+int main(int argc, char *argv[]) {
+    parse_modes_accepted = 1;   // -S -R -L -I are ours
+    handle_flags(argc, argv);
+    if (optind >= argc) {
+        cerr << "usage: " << argv[0] << " [flags] file...\n";
+        exit(1);
+    }
+    if (parse_outline)
+        jobs = 1;   // bodies are parsed on the shared scanner, one at a time
+    if (parse_incremental) {
+        fin = fopen(argv[optind], "r");
+        if (fin == NULL) {
+            cerr << "Could not open input file " << argv[optind] << endl;
+            exit(1);
+        }
+        curr_lineno = 1;
+        ParseContext ctx(curr_filename);
+        DumpWriter writer(1);
+        out = &writer;
+        return reparse(ctx, argc, argv);
+    }
+    return compile_batch(argc - optind, argv + optind, parse_file);
+}